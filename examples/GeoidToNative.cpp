@@ -0,0 +1,38 @@
+// Convert a geoid data file from PGM format to the native format read by the
+// Geoid class.  The native file has the same header as the PGM file but the
+// pixel data is little-endian and aligned so that, on little-endian machines,
+// it can be cached or memory mapped without swapping bytes.  The output file
+// should be named with the extension .geoid (in place of .pgm) and placed
+// alongside the PGM file; the Geoid class then reads it in preference to the
+// PGM file.  The data is always taken from the PGM file, so this can be rerun
+// to regenerate the native file after the PGM file has been updated.
+
+#include <iostream>
+#include <string>
+#include <geographic_lib/Geoid.hpp>
+
+using namespace std;
+using namespace geographic_lib;
+
+int main(int argc, const char* const argv[]) {
+  // Hardwired for 2 or 3 args:
+  // 1 = the geoid name (e.g., egm96-5)
+  // 2 = output file (e.g., egm96-5.geoid)
+  // 3 = (optional) the directory for the geoid data
+  if (argc != 3 && argc != 4) {
+    cerr << "Usage: " << argv[0] << " geoid-name output.geoid [dir]\n";
+    return 1;
+  }
+  try {
+    Geoid g(argv[1], argc == 4 ? string(argv[3]) : string(""));
+    g.WriteNative(argv[2]);
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+  catch (...) {
+    cerr << "Caught unknown exception\n";
+    return 1;
+  }
+}
@@ -0,0 +1,36 @@
+// Example of using the geographic_lib::GeodesicDistanceMatrix class
+
+#include <iostream>
+#include <iomanip>
+#include <exception>
+#include <vector>
+#include <geographic_lib/Geodesic.hpp>
+#include <geographic_lib/GeodesicDistanceMatrix.hpp>
+
+using namespace std;
+using namespace geographic_lib;
+
+int main() {
+  try {
+    GeodesicDistanceMatrix matrix(Geodesic::WGS84());
+    // Distances from 3 vehicles to 4 depots
+    double
+      vlat[] = {40.6, 51.6, 35.8},
+      vlon[] = {-73.8, -0.5, 140.4},
+      dlat[] = {1.4, -33.9, 49.0, 37.6},
+      dlon[] = {104.0, 151.2, 2.5, -122.4};
+    size_t n = 3, m = 4;
+    vector<double> s12(n * m);
+    matrix.Distances(n, vlat, vlon, m, dlat, dlon, &s12[0]);
+    cout << fixed << setprecision(0);
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = 0; j < m; ++j)
+        cout << setw(9) << s12[i * m + j] / 1000;
+      cout << "\n";
+    }
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+}
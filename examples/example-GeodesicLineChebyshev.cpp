@@ -0,0 +1,38 @@
+// Example of using the geographic_lib::GeodesicLineChebyshev class
+
+#include <iostream>
+#include <iomanip>
+#include <exception>
+#include <geographic_lib/Geodesic.hpp>
+#include <geographic_lib/GeodesicLine.hpp>
+#include <geographic_lib/GeodesicLineChebyshev.hpp>
+
+using namespace std;
+using namespace geographic_lib;
+
+int main() {
+  try {
+    const Geodesic& geod = Geodesic::WGS84();
+    double
+      lat1 = 40.640, lon1 = -73.779, // JFK
+      lat2 =  1.359, lon2 = 103.989; // SIN
+    const GeodesicLine line = geod.InverseLine(lat1, lon1, lat2, lon2);
+    // Approximate the route to within 1 micrometer
+    const GeodesicLineChebyshev route(line, line.Distance(), 1e-6);
+    cout << "intervals " << route.NumIntervals()
+         << ", max error " << route.MaxError() << " m"
+         << ", memory " << route.MemoryUsage() << " bytes"
+         << ", build time " << route.BuildTime() << " s\n";
+    cout << fixed << setprecision(6);
+    int num = 20;
+    for (int i = 0; i <= num; ++i) {
+      double lat, lon, azi;
+      route.Position(i * route.Distance() / num, lat, lon, azi);
+      cout << i << " " << lat << " " << lon << " " << azi << "\n";
+    }
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+}
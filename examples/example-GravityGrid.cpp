@@ -0,0 +1,34 @@
+// Example of using the geographic_lib::GravityGrid class
+
+#include <iostream>
+#include <exception>
+#include <vector>
+#include <geographic_lib/GravityModel.hpp>
+#include <geographic_lib/GravityGrid.hpp>
+
+using namespace std;
+using namespace geographic_lib;
+
+int main() {
+  try {
+    GravityModel grav("egm96");
+    // Geoid heights on a 1' grid covering 27N-28N, 86E-87E (Mt Everest)
+    GravityGrid grid(grav, GravityGrid::GEOID_HEIGHT,
+                     27, 86, 1/60.0, 1/60.0, 61, 61);
+    {
+      // Compute a few rows in memory
+      vector<double> N(3 * grid.NLon());
+      grid.Rows(30, 3, &N[0]);
+      cout << N[0] << " " << N[grid.NLon() + 30] << "\n";
+    }
+    {
+      // Stream the whole grid to files, reporting the progress
+      grid.WriteGTX("everest.gtx", &cerr);
+      grid.WritePGM("everest.pgm", -108, 0.003, false, &cerr);
+    }
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+}
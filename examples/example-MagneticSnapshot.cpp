@@ -0,0 +1,34 @@
+// Example of using the geographic_lib::MagneticSnapshot class
+
+#include <iostream>
+#include <exception>
+#include <geographic_lib/MagneticModel.hpp>
+#include <geographic_lib/MagneticSnapshot.hpp>
+
+using namespace std;
+using namespace geographic_lib;
+
+int main() {
+  try {
+    MagneticModel mag("wmm2010");
+    double t = 2012;
+    // Interpolate the model to time t once ...
+    MagneticSnapshot snap = mag.AtTime(t);
+    // ... and then evaluate the field at many points (here along a track
+    // from Mt Everest to the summit of Kanchenjunga)
+    double lat0 = 27.99, lon0 = 86.93, lat1 = 27.70, lon1 = 88.15, h = 8500;
+    for (int i = 0; i <= 10; ++i) {
+      double lat = lat0 + (lat1 - lat0) * i / 10,
+        lon = lon0 + (lon1 - lon0) * i / 10;
+      double Bx, By, Bz;
+      snap(lat, lon, h, Bx, By, Bz);
+      double H, F, D, I;
+      MagneticModel::FieldComponents(Bx, By, Bz, H, F, D, I);
+      cout << lat << " " << lon << " " << D << " " << I << "\n";
+    }
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+}
@@ -0,0 +1,548 @@
+// Benchmark the main geographic_lib classes on reproducible workloads and
+// write the results as JSON to standard output.  This is built by the
+// "geographiclib-bench" target (which is not part of the default build) and
+// requires C++11.
+//
+// Usage: geographiclib-bench [-n count] [-s seed] [-b batch] [pattern]
+//
+//   -n count: the number of operations per benchmark (default 100000)
+//   -s seed: the seed for the random inputs (default 20180101)
+//   -b batch: the number of operations timed together (default 64)
+//   pattern: only run the benchmarks whose "name/distribution" contains
+//     pattern
+//
+// The inputs are drawn from a 64-bit Mersenne twister, which is specified
+// exactly by the C++ standard, and converted to real numbers here (rather
+// than with std::uniform_real_distribution), so that a given seed yields the
+// same inputs on every platform.  Each benchmark reports a checksum of its
+// finite results and the number of non-finite results (e.g., rhumb lines
+// which pass over a pole); these should be unchanged between builds which are
+// expected to give identical results.
+//
+// The operations are timed in batches of "batch" consecutive calls; the
+// percentiles are of the mean time per operation in each batch.
+//
+// The benchmarks of Geoid, GravityModel, and MagneticModel use the default
+// datasets (see Geoid::DefaultGeoidName, etc.); if a dataset is not
+// installed, the benchmark is reported as skipped.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <geographic_lib/Geodesic.hpp>
+#include <geographic_lib/GeodesicLine.hpp>
+#include <geographic_lib/GeodesicExact.hpp>
+#include <geographic_lib/Rhumb.hpp>
+#include <geographic_lib/PolygonArea.hpp>
+#include <geographic_lib/TransverseMercator.hpp>
+#include <geographic_lib/UTMUPS.hpp>
+#include <geographic_lib/MGRS.hpp>
+#include <geographic_lib/Geoid.hpp>
+#include <geographic_lib/GravityModel.hpp>
+#include <geographic_lib/MagneticModel.hpp>
+#include <geographic_lib/Utility.hpp>
+
+using namespace std;
+using namespace geographic_lib;
+
+typedef Math::real real;
+
+// Portable uniform deviates
+class Random {
+private:
+  mt19937_64 _gen;
+public:
+  explicit Random(unsigned long long seed) : _gen(seed) {}
+  // Uniform in [a, b)
+  real Uniform(real a, real b) {
+    // The top 53 bits of the output give a double in [0, 1) exactly
+    double u = double(_gen() >> 11) / 9007199254740992.0;
+    return a + (b - a) * real(u);
+  }
+  // Uniform on the sphere
+  real Latitude() {
+    using std::asin;
+    return asin(Uniform(-1, 1)) / Math::degree();
+  }
+  real Longitude() { return Uniform(-180, 180); }
+  int Sign() { return (_gen() >> 63) ? 1 : -1; }
+};
+
+// Pairs of points drawn from one of the distributions
+class Points {
+private:
+  static void ZoneBoundary(Random& r, real& lat, real& lon) {
+    if (r.Sign() > 0) {
+      lat = r.Uniform(-80, 84);
+      lon = 6 * int(r.Uniform(-30, 30)) + r.Uniform(-0.001, 0.001);
+    } else {
+      lat = (r.Sign() > 0 ? 84 : -80) + r.Uniform(-0.001, 0.001);
+      lon = r.Longitude();
+    }
+  }
+public:
+  vector<real> lat1, lon1, lat2, lon2;
+  Points(Random& r, const string& dist, size_t n)
+    : lat1(n), lon1(n), lat2(n), lon2(n) {
+    for (size_t i = 0; i < n; ++i) {
+      if (dist == "short") {
+        // Separated by up to about 10 km
+        lat1[i] = r.Uniform(-89.9, 89.9); lon1[i] = r.Longitude();
+        lat2[i] = lat1[i] + r.Uniform(-0.05, 0.05);
+        lon2[i] = lon1[i] + r.Uniform(-0.05, 0.05);
+      } else if (dist == "long") {
+        lat1[i] = r.Latitude(); lon1[i] = r.Longitude();
+        lat2[i] = r.Latitude(); lon2[i] = r.Longitude();
+      } else if (dist == "antipodal") {
+        // Within half a degree of being antipodal
+        lat1[i] = r.Latitude(); lon1[i] = r.Longitude();
+        lat2[i] = -lat1[i] + r.Uniform(-0.5, 0.5);
+        lon2[i] = lon1[i] + 180 + r.Uniform(-0.5, 0.5);
+      } else if (dist == "polar") {
+        // Both points poleward of 80 degrees
+        lat1[i] = r.Sign() * r.Uniform(80, 90); lon1[i] = r.Longitude();
+        lat2[i] = r.Sign() * r.Uniform(80, 90); lon2[i] = r.Longitude();
+      } else if (dist == "zoneboundary") {
+        // Within about 100 m of a UTM zone boundary or the UTM/UPS boundary
+        ZoneBoundary(r, lat1[i], lon1[i]);
+        ZoneBoundary(r, lat2[i], lon2[i]);
+      } else
+        throw GeographicErr("Unknown distribution " + dist);
+      lat1[i] = max(real(-90), min(real(90), lat1[i]));
+      lat2[i] = max(real(-90), min(real(90), lat2[i]));
+    }
+  }
+};
+
+class Bench {
+private:
+  typedef chrono::steady_clock clock;
+  size_t _n, _batch;
+  unsigned long long _seed;
+  string _pattern;
+  ostringstream _out;
+  int _count;
+
+  static string Quote(const string& s) {
+    ostringstream str;
+    str << '"';
+    for (size_t i = 0; i < s.size(); ++i) {
+      char c = s[i];
+      if (c == '"' || c == '\\')
+        str << '\\' << c;
+      else if ((unsigned char)(c) < 0x20)
+        str << "\\u" << hex << setw(4) << setfill('0') << int(c)
+            << dec << setfill(' ');
+      else
+        str << c;
+    }
+    str << '"';
+    return str.str();
+  }
+
+  void Begin(const string& name, const string& dist) {
+    _out << (_count++ ? ",\n" : "\n")
+         << "    {\"name\": " << Quote(name)
+         << ", \"distribution\": " << Quote(dist);
+  }
+
+  static double Percentile(const vector<double>& v, double p) {
+    // Nearest rank; v is sorted
+    size_t k = size_t(ceil(p / 100 * double(v.size())));
+    return v[k > 0 ? k - 1 : 0];
+  }
+
+public:
+  Bench(size_t n, size_t batch, unsigned long long seed,
+        const string& pattern)
+    : _n(n), _batch(batch), _seed(seed), _pattern(pattern), _count(0) {}
+
+  size_t Count() const { return _n; }
+
+  bool Selected(const string& name, const string& dist) const {
+    return (name + "/" + dist).find(_pattern) != string::npos;
+  }
+
+  // A fresh generator for each benchmark so that the inputs for one
+  // benchmark do not depend on which others are run.
+  Random Generator(const string& name, const string& dist) const {
+    unsigned long long h = _seed;
+    string s = name + "/" + dist;
+    for (size_t i = 0; i < s.size(); ++i)
+      h = h * 1099511628211ULL + (unsigned char)(s[i]);
+    return Random(h);
+  }
+
+  // op(i) carries out the i'th operation and returns a real to be added to
+  // the checksum.
+  template<class Op>
+  void Run(const string& name, const string& dist, Op op) {
+    vector<double> perop;
+    perop.reserve(_n / _batch + 1);
+    real sum = 0;
+    size_t nonfinite = 0;
+    // One untimed batch to warm up the caches
+    for (size_t i = 0; i < min(_n, _batch); ++i)
+      op(i);
+    double total = 0;
+    for (size_t i0 = 0; i0 < _n; i0 += _batch) {
+      size_t i1 = min(_n, i0 + _batch);
+      clock::time_point t0 = clock::now();
+      for (size_t i = i0; i < i1; ++i) {
+        real v = op(i);
+        if (Math::isfinite(v))
+          sum += v;
+        else
+          ++nonfinite;
+      }
+      clock::time_point t1 = clock::now();
+      double ns = double(chrono::duration_cast<chrono::nanoseconds>
+                         (t1 - t0).count());
+      total += ns;
+      perop.push_back(ns / double(i1 - i0));
+    }
+    sort(perop.begin(), perop.end());
+    double nsop = total / double(_n), checksum = double(sum);
+    Begin(name, dist);
+    _out << setprecision(6)
+         << ", \"ops\": " << _n
+         << ", \"ns_per_op\": " << nsop
+         << ", \"ops_per_sec\": " << (total > 0 ? 1e9 / nsop : 0)
+         << ",\n     \"percentiles_ns\": {\"p50\": " << Percentile(perop, 50)
+         << ", \"p90\": " << Percentile(perop, 90)
+         << ", \"p99\": " << Percentile(perop, 99)
+         << ", \"max\": " << perop.back() << "}"
+         << ",\n     \"nonfinite\": " << nonfinite
+         << ", \"checksum\": " << setprecision(17) << checksum << "}";
+  }
+
+  void Skip(const string& name, const string& dist, const string& reason) {
+    Begin(name, dist);
+    _out << ", \"skipped\": " << Quote(reason) << "}";
+  }
+
+  void Write(ostream& str) const {
+    str << "{\n"
+        << "  \"library\": \"GeographicLib\",\n"
+        << "  \"version\": " << Quote(GEOGRAPHICLIB_VERSION_STRING) << ",\n"
+        << "  \"precision\": " << GEOGRAPHICLIB_PRECISION << ",\n"
+        << "  \"digits\": " << Math::digits() << ",\n"
+        << "  \"seed\": " << _seed << ",\n"
+        << "  \"count\": " << _n << ",\n"
+        << "  \"batch\": " << _batch << ",\n"
+        << "  \"benchmarks\": [" << _out.str() << "\n  ]\n"
+        << "}\n";
+  }
+};
+
+void GeodesicBenchmarks(Bench& b) {
+  const Geodesic& g = Geodesic::WGS84();
+  const GeodesicExact& ge = GeodesicExact::WGS84();
+  const char* inverse[] = {"short", "long", "antipodal", "polar"};
+  for (int k = 0; k < 4; ++k) {
+    string dist(inverse[k]);
+    if (b.Selected("geodesic.inverse", dist)) {
+      Random r = b.Generator("geodesic.inverse", dist);
+      Points p(r, dist, b.Count());
+      b.Run("geodesic.inverse", dist, [&](size_t i) -> real {
+          real s12, azi1, azi2;
+          g.Inverse(p.lat1[i], p.lon1[i], p.lat2[i], p.lon2[i],
+                    s12, azi1, azi2);
+          return s12 + azi1 + azi2;
+        });
+    }
+  }
+  // GeodesicExact is mainly of interest for long and nearly antipodal lines
+  for (int k = 1; k < 3; ++k) {
+    string dist(inverse[k]);
+    if (b.Selected("geodesicexact.inverse", dist)) {
+      Random r = b.Generator("geodesicexact.inverse", dist);
+      Points p(r, dist, b.Count());
+      b.Run("geodesicexact.inverse", dist, [&](size_t i) -> real {
+          real s12, azi1, azi2;
+          ge.Inverse(p.lat1[i], p.lon1[i], p.lat2[i], p.lon2[i],
+                     s12, azi1, azi2);
+          return s12 + azi1 + azi2;
+        });
+    }
+  }
+  // Direct problems with distances up to 10 km and up to 20000 km
+  const char* direct[] = {"short", "long"};
+  for (int k = 0; k < 2; ++k) {
+    string dist(direct[k]);
+    real smax = k == 0 ? real(1e4) : real(2e7);
+    if (b.Selected("geodesic.direct", dist)) {
+      Random r = b.Generator("geodesic.direct", dist);
+      Points p(r, "long", b.Count());
+      for (size_t i = 0; i < b.Count(); ++i) {
+        p.lat2[i] = r.Uniform(-180, 180); p.lon2[i] = r.Uniform(0, smax);
+      }
+      b.Run("geodesic.direct", dist, [&](size_t i) -> real {
+          real lat2, lon2, azi2;
+          g.Direct(p.lat1[i], p.lon1[i], p.lat2[i], p.lon2[i],
+                   lat2, lon2, azi2);
+          return lat2 + lon2 + azi2;
+        });
+    }
+    if (k == 1 && b.Selected("geodesicexact.direct", dist)) {
+      Random r = b.Generator("geodesicexact.direct", dist);
+      Points p(r, "long", b.Count());
+      for (size_t i = 0; i < b.Count(); ++i) {
+        p.lat2[i] = r.Uniform(-180, 180); p.lon2[i] = r.Uniform(0, smax);
+      }
+      b.Run("geodesicexact.direct", dist, [&](size_t i) -> real {
+          real lat2, lon2, azi2;
+          ge.Direct(p.lat1[i], p.lon1[i], p.lat2[i], p.lon2[i],
+                    lat2, lon2, azi2);
+          return lat2 + lon2 + azi2;
+        });
+    }
+  }
+  if (b.Selected("geodesicline.position", "long")) {
+    Random r = b.Generator("geodesicline.position", "long");
+    GeodesicLine l = g.Line(r.Latitude(), r.Longitude(), r.Uniform(-180, 180));
+    vector<real> s12(b.Count());
+    for (size_t i = 0; i < b.Count(); ++i)
+      s12[i] = r.Uniform(0, real(4e7));
+    b.Run("geodesicline.position", "long", [&](size_t i) -> real {
+        real lat2, lon2, azi2;
+        l.Position(s12[i], lat2, lon2, azi2);
+        return lat2 + lon2 + azi2;
+      });
+  }
+}
+
+void RhumbBenchmarks(Bench& b) {
+  const Rhumb& rh = Rhumb::WGS84();
+  if (b.Selected("rhumb.inverse", "long")) {
+    Random r = b.Generator("rhumb.inverse", "long");
+    Points p(r, "long", b.Count());
+    b.Run("rhumb.inverse", "long", [&](size_t i) -> real {
+        real s12, azi12;
+        rh.Inverse(p.lat1[i], p.lon1[i], p.lat2[i], p.lon2[i], s12, azi12);
+        return s12 + azi12;
+      });
+  }
+  if (b.Selected("rhumb.direct", "long")) {
+    Random r = b.Generator("rhumb.direct", "long");
+    Points p(r, "long", b.Count());
+    for (size_t i = 0; i < b.Count(); ++i) {
+      p.lat2[i] = r.Uniform(-180, 180); p.lon2[i] = r.Uniform(0, real(1e7));
+    }
+    b.Run("rhumb.direct", "long", [&](size_t i) -> real {
+        real lat2, lon2;
+        rh.Direct(p.lat1[i], p.lon1[i], p.lat2[i], p.lon2[i], lat2, lon2);
+        return lat2 + lon2;
+      });
+  }
+}
+
+void PolygonAreaBenchmarks(Bench& b) {
+  // Each operation computes the area of a polygon with nv vertices scattered
+  // within about 10 km of a center point.
+  const int nv = 16;
+  string dist = "short16";
+  if (!b.Selected("polygonarea.compute", dist)) return;
+  Random r = b.Generator("polygonarea.compute", dist);
+  Points p(r, "short", b.Count() * nv);
+  PolygonArea poly(Geodesic::WGS84());
+  b.Run("polygonarea.compute", dist, [&](size_t i) -> real {
+      poly.Clear();
+      for (size_t j = i * nv; j < (i + 1) * nv; ++j)
+        poly.AddPoint(p.lat2[j] - p.lat1[j] + p.lat1[i * nv],
+                      p.lon2[j] - p.lon1[j] + p.lon1[i * nv]);
+      real perimeter, area;
+      poly.Compute(false, true, perimeter, area);
+      return perimeter + area;
+    });
+}
+
+void ProjectionBenchmarks(Bench& b) {
+  const TransverseMercator& tm = TransverseMercator::UTM();
+  // Points within 3 degrees of the central meridian (i.e., a UTM zone)
+  if (b.Selected("transversemercator.forward", "utm") ||
+      b.Selected("transversemercator.reverse", "utm")) {
+    Random r = b.Generator("transversemercator", "utm");
+    Points p(r, "long", b.Count());
+    for (size_t i = 0; i < b.Count(); ++i) {
+      p.lat1[i] = r.Uniform(-80, 84); p.lon1[i] = r.Uniform(-3, 3);
+      real gamma, k;
+      tm.Forward(0, p.lat1[i], p.lon1[i], p.lat2[i], p.lon2[i], gamma, k);
+    }
+    if (b.Selected("transversemercator.forward", "utm"))
+      b.Run("transversemercator.forward", "utm", [&](size_t i) -> real {
+          real x, y;
+          tm.Forward(0, p.lat1[i], p.lon1[i], x, y);
+          return x + y;
+        });
+    if (b.Selected("transversemercator.reverse", "utm"))
+      b.Run("transversemercator.reverse", "utm", [&](size_t i) -> real {
+          real lat, lon;
+          tm.Reverse(0, p.lat2[i], p.lon2[i], lat, lon);
+          return lat + lon;
+        });
+  }
+  const char* forward[] = {"long", "zoneboundary", "polar"};
+  for (int k = 0; k < 3; ++k) {
+    string dist(forward[k]);
+    if (!b.Selected("utmups.forward", dist)) continue;
+    Random r = b.Generator("utmups.forward", dist);
+    Points p(r, dist, b.Count());
+    b.Run("utmups.forward", dist, [&](size_t i) -> real {
+        int zone; bool northp; real x, y;
+        UTMUPS::Forward(p.lat1[i], p.lon1[i], zone, northp, x, y);
+        return x + y + zone;
+      });
+  }
+  if (b.Selected("utmups.reverse", "long") ||
+      b.Selected("mgrs.forward", "long") ||
+      b.Selected("mgrs.reverse", "long")) {
+    Random r = b.Generator("utmups", "long");
+    Points p(r, "long", b.Count());
+    vector<int> zone(b.Count());
+    vector<char> northp(b.Count());
+    vector<string> mgrs(b.Count());
+    for (size_t i = 0; i < b.Count(); ++i) {
+      bool n;
+      UTMUPS::Forward(p.lat1[i], p.lon1[i], zone[i], n, p.lat2[i], p.lon2[i]);
+      northp[i] = n;
+      MGRS::Forward(zone[i], n, p.lat2[i], p.lon2[i], p.lat1[i], 5, mgrs[i]);
+    }
+    if (b.Selected("utmups.reverse", "long"))
+      b.Run("utmups.reverse", "long", [&](size_t i) -> real {
+          real lat, lon;
+          UTMUPS::Reverse(zone[i], northp[i] != 0, p.lat2[i], p.lon2[i],
+                          lat, lon);
+          return lat + lon;
+        });
+    if (b.Selected("mgrs.forward", "long")) {
+      string s;
+      b.Run("mgrs.forward", "long", [&](size_t i) -> real {
+          MGRS::Forward(zone[i], northp[i] != 0, p.lat2[i], p.lon2[i], 5, s);
+          return real(s[s.size() - 1]);
+        });
+    }
+    if (b.Selected("mgrs.reverse", "long"))
+      b.Run("mgrs.reverse", "long", [&](size_t i) -> real {
+          int z, prec; bool n; real x, y;
+          MGRS::Reverse(mgrs[i], z, n, x, y, prec);
+          return x + y;
+        });
+  }
+}
+
+void ModelBenchmarks(Bench& b) {
+  if (b.Selected("geoid.height", "long")) {
+    string name = Geoid::DefaultGeoidName();
+    try {
+      Geoid geoid(name);
+      Random r = b.Generator("geoid.height", "long");
+      Points p(r, "long", b.Count());
+      b.Run("geoid.height", "long", [&](size_t i) -> real {
+          return geoid(p.lat1[i], p.lon1[i]);
+        });
+    }
+    catch (const GeographicErr& e) {
+      b.Skip("geoid.height", "long", name + ": " + e.what());
+    }
+  }
+  if (b.Selected("gravitymodel.gravity", "long")) {
+    string name = GravityModel::DefaultGravityName();
+    try {
+      GravityModel grav(name);
+      Random r = b.Generator("gravitymodel.gravity", "long");
+      Points p(r, "long", b.Count());
+      for (size_t i = 0; i < b.Count(); ++i)
+        p.lat2[i] = r.Uniform(-100, real(1e4));
+      b.Run("gravitymodel.gravity", "long", [&](size_t i) -> real {
+          real gx, gy, gz;
+          return grav.Gravity(p.lat1[i], p.lon1[i], p.lat2[i], gx, gy, gz)
+            + gx + gy + gz;
+        });
+    }
+    catch (const GeographicErr& e) {
+      b.Skip("gravitymodel.gravity", "long", name + ": " + e.what());
+    }
+  }
+  if (b.Selected("magneticmodel.field", "long")) {
+    string name = MagneticModel::DefaultMagneticName();
+    try {
+      MagneticModel mag(name);
+      Random r = b.Generator("magneticmodel.field", "long");
+      Points p(r, "long", b.Count());
+      for (size_t i = 0; i < b.Count(); ++i) {
+        p.lat2[i] = r.Uniform(-100, real(1e4));
+        p.lon2[i] = r.Uniform(mag.MinTime(), mag.MaxTime());
+      }
+      b.Run("magneticmodel.field", "long", [&](size_t i) -> real {
+          real bx, by, bz;
+          mag(p.lon2[i], p.lat1[i], p.lon1[i], p.lat2[i], bx, by, bz);
+          return bx + by + bz;
+        });
+    }
+    catch (const GeographicErr& e) {
+      b.Skip("magneticmodel.field", "long", name + ": " + e.what());
+    }
+  }
+}
+
+int usage(const char* prog, int retval) {
+  (retval ? cerr : cout)
+    << "Usage: " << prog << " [-n count] [-s seed] [-b batch] [pattern]\n";
+  return retval;
+}
+
+int main(int argc, const char* const argv[]) {
+  try {
+    Utility::set_digits();
+    size_t n = 100000, batch = 64;
+    unsigned long long seed = 20180101ULL;
+    string pattern;
+    for (int m = 1; m < argc; ++m) {
+      string arg(argv[m]);
+      if (arg == "-n" || arg == "-s" || arg == "-b") {
+        if (++m == argc) return usage(argv[0], 1);
+        try {
+          if (arg == "-n")
+            n = Utility::val<size_t>(string(argv[m]));
+          else if (arg == "-s")
+            seed = Utility::val<unsigned long long>(string(argv[m]));
+          else
+            batch = Utility::val<size_t>(string(argv[m]));
+        }
+        catch (const exception&) {
+          cerr << "Bad argument " << argv[m] << " for " << arg << "\n";
+          return 1;
+        }
+      } else if (arg == "-h" || arg == "--help")
+        return usage(argv[0], 0);
+      else if (arg.size() > 1 && arg[0] == '-')
+        return usage(argv[0], 1);
+      else
+        pattern = arg;
+    }
+    if (n == 0 || batch == 0) {
+      cerr << "The count and batch size must be positive\n";
+      return 1;
+    }
+    Bench b(n, batch, seed, pattern);
+    GeodesicBenchmarks(b);
+    RhumbBenchmarks(b);
+    PolygonAreaBenchmarks(b);
+    ProjectionBenchmarks(b);
+    ModelBenchmarks(b);
+    b.Write(cout);
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+  return 0;
+}
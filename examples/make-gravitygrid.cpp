@@ -0,0 +1,89 @@
+// Generate a grid of geoid heights, gravity disturbances, or gravity
+// anomalies from a gravity model using the GravityGrid class and write it as
+// a PGM, native (.geoid), or GTX file.  If the library is compiled with
+// OpenMP, the rows are computed in parallel.  The progress and throughput are
+// reported on standard error.
+//
+// For example, a global 2.5' geoid grid which can be read by the Geoid class
+// is generated by
+//
+//   make-gravitygrid egm2008 geoid 24 egm2008-2_5.pgm
+//
+// and a regional 1' grid of gravity anomalies (in m s^-2) over 30N-50N,
+// 120W-70W by
+//
+//   make-gravitygrid egm2008 anomaly 60 conus.gtx 30 -120 50 -70
+
+#include <iostream>
+#include <string>
+#include <geographic_lib/GravityModel.hpp>
+#include <geographic_lib/GravityGrid.hpp>
+#include <geographic_lib/Utility.hpp>
+
+using namespace std;
+using namespace geographic_lib;
+
+int main(int argc, const char* const argv[]) {
+  // Hardwired for 4 or 8 args:
+  // 1 = the gravity model (e.g., egm2008)
+  // 2 = the quantity (geoid, disturbance, anomaly)
+  // 3 = intervals per degree
+  // 4 = output file; the format is given by the extension (.pgm, .geoid,
+  //     .gtx)
+  // 5-8 = (optional) south west north east; the default is a global grid
+  if (argc != 5 && argc != 9) {
+    cerr << "Usage: " << argv[0]
+         << " gravity-model geoid|disturbance|anomaly intervals-per-degree"
+         << " output.{pgm,geoid,gtx} [south west north east]\n";
+    return 1;
+  }
+  try {
+    Utility::set_digits();
+    string model(argv[1]), q(argv[2]), filename(argv[4]);
+    int ndeg = Utility::val<int>(string(argv[3]));
+    GravityGrid::quantity quantity =
+      q == "geoid" ? GravityGrid::GEOID_HEIGHT :
+      q == "disturbance" ? GravityGrid::DISTURBANCE :
+      q == "anomaly" ? GravityGrid::ANOMALY :
+      throw GeographicErr("Unknown quantity " + q);
+    if (!(ndeg > 0))
+      throw GeographicErr("Intervals per degree must be positive");
+    int south = -90, west = 0, north = 90, east = 360;
+    if (argc == 9) {
+      south = Utility::val<int>(string(argv[5]));
+      west = Utility::val<int>(string(argv[6]));
+      north = Utility::val<int>(string(argv[7]));
+      east = Utility::val<int>(string(argv[8]));
+    }
+    // A global grid doesn't repeat the column at 360
+    int
+      nlat = (north - south) * ndeg + 1,
+      nlon = (east - west) * ndeg + (east - west == 360 ? 0 : 1);
+    Math::real delta = 1 / Math::real(ndeg);
+    GravityModel g(model);
+    GravityGrid grid(g, quantity, south, west, delta, delta, nlat, nlon);
+    cerr << "Computing " << nlat << " x " << nlon << " grid with up to "
+         << GravityGrid::MaxThreads() << " threads\n";
+    string ext = filename.substr(filename.find_last_of('.') + 1);
+    // For PGM files, the geoid heights are quantized as in the data files for
+    // Geoid; the gravity disturbances and anomalies are quantized to 2e-7 m
+    // s^-2 (0.02 mGal) covering +/-6.5e-3 m s^-2 (655 mGal).
+    Math::real
+      offset = quantity == GravityGrid::GEOID_HEIGHT ? -108 : -0.0065536,
+      scale = quantity == GravityGrid::GEOID_HEIGHT ? 0.003 : 2e-7;
+    if (ext == "gtx")
+      grid.WriteGTX(filename, &cerr);
+    else if (ext == "pgm" || ext == "geoid")
+      grid.WritePGM(filename, offset, scale, ext == "geoid", &cerr);
+    else
+      throw GeographicErr("Unknown output format " + ext);
+  }
+  catch (const exception& e) {
+    cerr << "Caught exception: " << e.what() << "\n";
+    return 1;
+  }
+  catch (...) {
+    cerr << "Caught unknown exception\n";
+    return 1;
+  }
+}
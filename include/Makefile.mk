@@ -10,20 +10,25 @@ MODULES = Accumulator \
 	GeoCoords \
 	Geocentric \
 	Geodesic \
+	GeodesicDistanceMatrix \
 	GeodesicExact \
 	GeodesicLine \
+	GeodesicLineChebyshev \
 	GeodesicLineExact \
+	GeodesicStatistics \
 	Geohash \
 	Geoid \
 	Georef \
 	Gnomonic \
 	GravityCircle \
+	GravityGrid \
 	GravityModel \
 	LambertConformalConic \
 	LocalCartesian \
 	MGRS \
 	MagneticCircle \
 	MagneticModel \
+	MagneticSnapshot \
 	Math \
 	NormalGravity \
 	OSGB \
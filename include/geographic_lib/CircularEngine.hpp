@@ -65,6 +65,12 @@ namespace geographic_lib {
 
     Math::real Value(bool gradp, real sl, real cl,
                      real& gradx, real& grady, real& gradz) const;
+    // The number of longitudes evaluated together by Values
+    static const int lanes_ = 8;
+    // Evaluate the sums for n <= lanes_ longitudes
+    template<bool gradp>
+    void ValueBlock(int n, const real sl[], const real cl[], real v[],
+                    real gradx[], real grady[], real gradz[]) const;
 
     friend class SphericalEngine;
     CircularEngine(int M, bool gradp, unsigned norm,
@@ -184,6 +190,43 @@ namespace geographic_lib {
       Math::sincosd(lon, sinlon, coslon);
       return (*this)(sinlon, coslon, gradx, grady, gradz);
     }
+
+    /**
+     * Evaluate the sum for equally spaced longitudes.
+     *
+     * @param[in] lon0 the first longitude (degrees).
+     * @param[in] dlon the spacing of the longitudes (degrees).
+     * @param[in] n the number of longitudes.
+     * @param[out] v an array of \e n values of the sum; \e v[\e j] is the
+     *   value at longitude \e lon0 + \e j \e dlon.
+     *
+     * This gives the same results as \e n calls to operator()(real lon)
+     * const.  However, the sums for several longitudes are carried out
+     * together, which allows the compiler to vectorize the summation over
+     * order, so that this is faster (by about a factor of 3 for the value
+     * alone and 2 with the gradient for high degree sums).  This routine
+     * requires constant memory and thus never throws an exception.
+     **********************************************************************/
+    void Values(real lon0, real dlon, size_t n, real v[]) const;
+
+    /**
+     * Evaluate the sum and its gradient for equally spaced longitudes.
+     *
+     * @param[in] lon0 the first longitude (degrees).
+     * @param[in] dlon the spacing of the longitudes (degrees).
+     * @param[in] n the number of longitudes.
+     * @param[out] v an array of \e n values of the sum.
+     * @param[out] gradx an array of \e n \e x components of the gradient.
+     * @param[out] grady an array of \e n \e y components of the gradient.
+     * @param[out] gradz an array of \e n \e z components of the gradient.
+     *
+     * The gradients will only be computed if the CircularEngine object was
+     * created with this capability (e.g., via \e gradp = true in
+     * SphericalHarmonic::Circle).  If not, \e gradx, etc., will not be
+     * touched.
+     **********************************************************************/
+    void Values(real lon0, real dlon, size_t n, real v[],
+                real gradx[], real grady[], real gradz[]) const;
   };
 
 } // namespace geographic_lib
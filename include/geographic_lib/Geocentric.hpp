@@ -70,6 +70,7 @@ namespace geographic_lib {
     friend class LocalCartesian;
     friend class MagneticCircle; // MagneticCircle uses Rotation
     friend class MagneticModel;  // MagneticModel uses IntForward
+    friend class MagneticSnapshot; // MagneticSnapshot uses IntForward
     friend class GravityCircle;  // GravityCircle uses Rotation
     friend class GravityModel;   // GravityModel uses IntForward
     friend class NormalGravity;  // NormalGravity uses IntForward
@@ -11,6 +11,7 @@
 #define GEOGRAPHICLIB_GEODESIC_HPP 1
 
 #include <geographic_lib/Constants.hpp>
+#include <geographic_lib/GeodesicStatistics.hpp>
 
 #if !defined(GEOGRAPHICLIB_GEODESIC_ORDER)
 /**
@@ -25,7 +26,23 @@
 
 namespace geographic_lib {
 
-  class GeodesicLine;
+  template<typename T> class GeodesicLineT;
+  template<typename T> class GeodesicPointT;
+  template<typename T> class GeodesicDistanceMatrixT;
+
+  /// \cond SKIP
+  // The order of the series used by GeodesicT<T>.  This is
+  // GEOGRAPHICLIB_GEODESIC_ORDER, except that single precision uses the order
+  // that GEOGRAPHICLIB_PRECISION = 1 would select.
+  template<typename T> struct GeodesicOrder {
+    static const int order = GEOGRAPHICLIB_GEODESIC_ORDER;
+  };
+#if GEOGRAPHICLIB_PRECISION != 1
+  template<> struct GeodesicOrder<float> {
+    static const int order = 3;
+  };
+#endif
+  /// \endcond
 
   /**
    * \brief %Geodesic calculations
@@ -149,6 +166,14 @@ namespace geographic_lib {
    * </pre>
    * For very eccentric ellipsoids, use GeodesicExact instead.
    *
+   * This is a templated class to allow the calculations to be carried out in
+   * a type \e T other than Math::real.  Geodesic (\e T = Math::real) and
+   * GeodesicF (\e T = float) are instantiated in the library.  GeodesicF uses
+   * series of order 3; its errors, about 2 m for distances up to 1000 km and
+   * 5 m globally, are dominated by the resolution of a float representing an
+   * angle in degrees.  It halves the memory needed to hold arrays of
+   * coordinates (e.g., for GeodesicT::InverseBatch).
+   *
    * The algorithms are described in
    * - C. F. F. Karney,
    *   <a href="https://doi.org/10.1007/s00190-012-0578-z">
@@ -169,24 +194,30 @@ namespace geographic_lib {
    * providing access to the functionality of Geodesic and GeodesicLine.
    **********************************************************************/
 
-  class GEOGRAPHICLIB_EXPORT Geodesic {
+  template<typename T>
+  class GeodesicT {
   private:
-    typedef Math::real real;
-    friend class GeodesicLine;
-    static const int nA1_ = GEOGRAPHICLIB_GEODESIC_ORDER;
-    static const int nC1_ = GEOGRAPHICLIB_GEODESIC_ORDER;
-    static const int nC1p_ = GEOGRAPHICLIB_GEODESIC_ORDER;
-    static const int nA2_ = GEOGRAPHICLIB_GEODESIC_ORDER;
-    static const int nC2_ = GEOGRAPHICLIB_GEODESIC_ORDER;
-    static const int nA3_ = GEOGRAPHICLIB_GEODESIC_ORDER;
+    typedef T real;
+    friend class GeodesicLineT<T>;
+    friend class GeodesicPointT<T>;
+    friend class GeodesicDistanceMatrixT<T>; // For access to OUT_MASK
+    static const int nA1_ = GeodesicOrder<T>::order;
+    static const int nC1_ = GeodesicOrder<T>::order;
+    static const int nC1p_ = GeodesicOrder<T>::order;
+    static const int nA2_ = GeodesicOrder<T>::order;
+    static const int nC2_ = GeodesicOrder<T>::order;
+    static const int nA3_ = GeodesicOrder<T>::order;
     static const int nA3x_ = nA3_;
-    static const int nC3_ = GEOGRAPHICLIB_GEODESIC_ORDER;
+    static const int nC3_ = GeodesicOrder<T>::order;
     static const int nC3x_ = (nC3_ * (nC3_ - 1)) / 2;
-    static const int nC4_ = GEOGRAPHICLIB_GEODESIC_ORDER;
+    static const int nC4_ = GeodesicOrder<T>::order;
     static const int nC4x_ = (nC4_ * (nC4_ + 1)) / 2;
     // Size for temporary array
     // nC = max(max(nC1_, nC1p_, nC2_) + 1, max(nC3_, nC4_))
-    static const int nC_ = GEOGRAPHICLIB_GEODESIC_ORDER + 1;
+    static const int nC_ = GeodesicOrder<T>::order + 1;
+    // Size of the per-point array filled by InverseTerms (and held by
+    // GeodesicPointT)
+    static const int nrl_ = 7;
     static const unsigned maxit1_ = 20;
     unsigned maxit2_;
     real tiny_, tol0_, tol1_, tol2_, tolb_, xthresh_;
@@ -207,10 +238,16 @@ namespace geographic_lib {
     static real SinCosSeries(bool sinp,
                              real sinx, real cosx, const real c[], int n);
     static real Astroid(real x, real y);
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+    // The statistics for this thread
+    static GeodesicStatistics& Stats();
+#endif
 
     real _a, _f, _f1, _e2, _ep2, _n, _b, _c2, _etol2;
     real _A3x[nA3x_], _C3x[nC3x_], _C4x[nC4x_];
 
+    void ReducedLatitude(real lat, real& sbet, real& cbet, real& dn) const;
+
     void Lengths(real eps, real sig12,
                  real ssig1, real csig1, real dn1,
                  real ssig2, real csig2, real dn2,
@@ -230,7 +267,14 @@ namespace geographic_lib {
                   real& ssig1, real& csig1, real& ssig2, real& csig2,
                   real& eps, real& domg12,
                   bool diffp, real& dlam12, real Ca[]) const;
+    // The terms in GenInverse which depend only on one latitude: rl[0] =
+    // rounded latitude, rl[1,2,3] = sbet, cbet, dn for the latitude, and
+    // rl[4,5,6] = the same for its negative.
+    void InverseTerms(real lat, real rl[]) const;
+    // If rl1 and rl2 are both non-null, they point to arrays filled by
+    // InverseTerms for lat1 and lat2.
     real GenInverse(real lat1, real lon1, real lat2, real lon2,
+                    const real rl1[], const real rl2[],
                     unsigned outmask, real& s12,
                     real& salp1, real& calp1, real& salp2, real& calp2,
                     real& m12, real& M12, real& M21, real& S12) const;
@@ -335,7 +379,7 @@ namespace geographic_lib {
      * @exception GeographicErr if \e a or (1 &minus; \e f) \e a is not
      *   positive.
      **********************************************************************/
-    Geodesic(real a, real f);
+    GeodesicT(real a, real f);
     ///@}
 
     /** \name Direct geodesic problem specified in terms of distance.
@@ -376,9 +420,9 @@ namespace geographic_lib {
      * which omit some of the output parameters.  Note, however, that the arc
      * length is always computed and returned as the function value.
      **********************************************************************/
-    Math::real Direct(real lat1, real lon1, real azi1, real s12,
-                      real& lat2, real& lon2, real& azi2,
-                      real& m12, real& M12, real& M21, real& S12)
+    real Direct(real lat1, real lon1, real azi1, real s12,
+                real& lat2, real& lon2, real& azi2,
+                real& m12, real& M12, real& M21, real& S12)
       const {
       real t;
       return GenDirect(lat1, lon1, azi1, false, s12,
@@ -390,8 +434,8 @@ namespace geographic_lib {
     /**
      * See the documentation for Geodesic::Direct.
      **********************************************************************/
-    Math::real Direct(real lat1, real lon1, real azi1, real s12,
-                      real& lat2, real& lon2)
+    real Direct(real lat1, real lon1, real azi1, real s12,
+                real& lat2, real& lon2)
       const {
       real t;
       return GenDirect(lat1, lon1, azi1, false, s12,
@@ -402,8 +446,8 @@ namespace geographic_lib {
     /**
      * See the documentation for Geodesic::Direct.
      **********************************************************************/
-    Math::real Direct(real lat1, real lon1, real azi1, real s12,
-                      real& lat2, real& lon2, real& azi2)
+    real Direct(real lat1, real lon1, real azi1, real s12,
+                real& lat2, real& lon2, real& azi2)
       const {
       real t;
       return GenDirect(lat1, lon1, azi1, false, s12,
@@ -414,8 +458,8 @@ namespace geographic_lib {
     /**
      * See the documentation for Geodesic::Direct.
      **********************************************************************/
-    Math::real Direct(real lat1, real lon1, real azi1, real s12,
-                      real& lat2, real& lon2, real& azi2, real& m12)
+    real Direct(real lat1, real lon1, real azi1, real s12,
+                real& lat2, real& lon2, real& azi2, real& m12)
       const {
       real t;
       return GenDirect(lat1, lon1, azi1, false, s12,
@@ -426,9 +470,9 @@ namespace geographic_lib {
     /**
      * See the documentation for Geodesic::Direct.
      **********************************************************************/
-    Math::real Direct(real lat1, real lon1, real azi1, real s12,
-                      real& lat2, real& lon2, real& azi2,
-                      real& M12, real& M21)
+    real Direct(real lat1, real lon1, real azi1, real s12,
+                real& lat2, real& lon2, real& azi2,
+                real& M12, real& M21)
       const {
       real t;
       return GenDirect(lat1, lon1, azi1, false, s12,
@@ -439,9 +483,9 @@ namespace geographic_lib {
     /**
      * See the documentation for Geodesic::Direct.
      **********************************************************************/
-    Math::real Direct(real lat1, real lon1, real azi1, real s12,
-                      real& lat2, real& lon2, real& azi2,
-                      real& m12, real& M12, real& M21)
+    real Direct(real lat1, real lon1, real azi1, real s12,
+                real& lat2, real& lon2, real& azi2,
+                real& m12, real& M12, real& M21)
       const {
       real t;
       return GenDirect(lat1, lon1, azi1, false, s12,
@@ -626,11 +670,90 @@ namespace geographic_lib {
      * lon1 indicates how many times and in what sense the geodesic encircles
      * the ellipsoid.
      **********************************************************************/
-    Math::real GenDirect(real lat1, real lon1, real azi1,
-                         bool arcmode, real s12_a12, unsigned outmask,
-                         real& lat2, real& lon2, real& azi2,
-                         real& s12, real& m12, real& M12, real& M21,
-                         real& S12) const;
+    real GenDirect(real lat1, real lon1, real azi1,
+                   bool arcmode, real s12_a12, unsigned outmask,
+                   real& lat2, real& lon2, real& azi2,
+                   real& s12, real& m12, real& M12, real& M21,
+                   real& S12) const;
+    ///@}
+
+    /** \name Batch version of direct geodesic solution.
+     **********************************************************************/
+    ///@{
+    /**
+     * Solve the direct geodesic problem for many starting points, azimuths,
+     * and distances or arc lengths.
+     *
+     * @param[in] n the number of geodesics.
+     * @param[in] lat1 array of \e n latitudes of point 1 (degrees).
+     * @param[in] lon1 array of \e n longitudes of point 1 (degrees).
+     * @param[in] azi1 array of \e n azimuths at point 1 (degrees).
+     * @param[in] arcmode boolean flag determining the meaning of the \e
+     *   s12_a12.
+     * @param[in] s12_a12 array of \e n distances between point 1 and point 2
+     *   (meters), if \e arcmode is false; otherwise array of \e n arc lengths
+     *   between point 1 and point 2 (degrees).
+     * @param[in] outmask a bitor'ed combination of Geodesic::mask values
+     *   specifying which of the following arrays should be set.
+     * @param[out] a12 array of \e n arc lengths between point 1 and point 2
+     *   (degrees).
+     * @param[out] lat2 array of \e n latitudes of point 2 (degrees).
+     * @param[out] lon2 array of \e n longitudes of point 2 (degrees).
+     * @param[out] azi2 array of \e n (forward) azimuths at point 2 (degrees).
+     * @param[out] s12 array of \e n distances between point 1 and point 2
+     *   (meters).
+     * @param[out] m12 array of \e n reduced lengths of geodesic (meters).
+     * @param[out] M12 array of \e n geodesic scales of point 2 relative to
+     *   point 1 (dimensionless).
+     * @param[out] M21 array of \e n geodesic scales of point 1 relative to
+     *   point 2 (dimensionless).
+     * @param[out] S12 array of \e n areas under the geodesic
+     *   (meters<sup>2</sup>).
+     *
+     * This is equivalent to calling Geodesic::GenDirect \e n times and the
+     * results are identical.  However the work which depends only on the
+     * starting latitude is skipped if \e lat1 is the same as for the previous
+     * element and the coefficients of the series for the geodesic are reused
+     * if \e lat1, \e lon1, and \e azi1 are all the same as for the previous
+     * element.  So a fan of geodesics from a single point should be ordered by
+     * azimuth with the distances for each azimuth given consecutively.  Output
+     * arrays which are not requested via \e outmask are not referenced and may
+     * be null pointers; \e a12 is only stored if it is not null.  No memory is
+     * allocated by this function.
+     *
+     * The Geodesic::mask values possible for \e outmask are the same as for
+     * Geodesic::GenDirect.
+     **********************************************************************/
+    void GenDirectBatch(size_t n,
+                        const real lat1[], const real lon1[],
+                        const real azi1[], bool arcmode,
+                        const real s12_a12[], unsigned outmask,
+                        real a12[], real lat2[], real lon2[], real azi2[],
+                        real s12[], real m12[], real M12[], real M21[],
+                        real S12[]) const;
+
+    /**
+     * See the documentation for Geodesic::GenDirectBatch.
+     **********************************************************************/
+    void DirectBatch(size_t n,
+                     const real lat1[], const real lon1[],
+                     const real azi1[], const real s12[],
+                     real lat2[], real lon2[]) const {
+      GenDirectBatch(n, lat1, lon1, azi1, false, s12, LATITUDE | LONGITUDE,
+                     0, lat2, lon2, 0, 0, 0, 0, 0, 0);
+    }
+
+    /**
+     * See the documentation for Geodesic::GenDirectBatch.
+     **********************************************************************/
+    void DirectBatch(size_t n,
+                     const real lat1[], const real lon1[],
+                     const real azi1[], const real s12[],
+                     real lat2[], real lon2[], real azi2[]) const {
+      GenDirectBatch(n, lat1, lon1, azi1, false, s12,
+                     LATITUDE | LONGITUDE | AZIMUTH,
+                     0, lat2, lon2, azi2, 0, 0, 0, 0, 0);
+    }
     ///@}
 
     /** \name Inverse geodesic problem.
@@ -671,9 +794,9 @@ namespace geographic_lib {
      * which omit some of the output parameters.  Note, however, that the arc
      * length is always computed and returned as the function value.
      **********************************************************************/
-    Math::real Inverse(real lat1, real lon1, real lat2, real lon2,
-                       real& s12, real& azi1, real& azi2, real& m12,
-                       real& M12, real& M21, real& S12) const {
+    real Inverse(real lat1, real lon1, real lat2, real lon2,
+                 real& s12, real& azi1, real& azi2, real& m12,
+                 real& M12, real& M21, real& S12) const {
       return GenInverse(lat1, lon1, lat2, lon2,
                         DISTANCE | AZIMUTH |
                         REDUCEDLENGTH | GEODESICSCALE | AREA,
@@ -683,8 +806,8 @@ namespace geographic_lib {
     /**
      * See the documentation for Geodesic::Inverse.
      **********************************************************************/
-    Math::real Inverse(real lat1, real lon1, real lat2, real lon2,
-                       real& s12) const {
+    real Inverse(real lat1, real lon1, real lat2, real lon2,
+                 real& s12) const {
       real t;
       return GenInverse(lat1, lon1, lat2, lon2,
                         DISTANCE,
@@ -694,8 +817,8 @@ namespace geographic_lib {
     /**
      * See the documentation for Geodesic::Inverse.
      **********************************************************************/
-    Math::real Inverse(real lat1, real lon1, real lat2, real lon2,
-                       real& azi1, real& azi2) const {
+    real Inverse(real lat1, real lon1, real lat2, real lon2,
+                 real& azi1, real& azi2) const {
       real t;
       return GenInverse(lat1, lon1, lat2, lon2,
                         AZIMUTH,
@@ -705,8 +828,8 @@ namespace geographic_lib {
     /**
      * See the documentation for Geodesic::Inverse.
      **********************************************************************/
-    Math::real Inverse(real lat1, real lon1, real lat2, real lon2,
-                       real& s12, real& azi1, real& azi2)
+    real Inverse(real lat1, real lon1, real lat2, real lon2,
+                 real& s12, real& azi1, real& azi2)
       const {
       real t;
       return GenInverse(lat1, lon1, lat2, lon2,
@@ -717,8 +840,8 @@ namespace geographic_lib {
     /**
      * See the documentation for Geodesic::Inverse.
      **********************************************************************/
-    Math::real Inverse(real lat1, real lon1, real lat2, real lon2,
-                       real& s12, real& azi1, real& azi2, real& m12)
+    real Inverse(real lat1, real lon1, real lat2, real lon2,
+                 real& s12, real& azi1, real& azi2, real& m12)
       const {
       real t;
       return GenInverse(lat1, lon1, lat2, lon2,
@@ -729,9 +852,9 @@ namespace geographic_lib {
     /**
      * See the documentation for Geodesic::Inverse.
      **********************************************************************/
-    Math::real Inverse(real lat1, real lon1, real lat2, real lon2,
-                       real& s12, real& azi1, real& azi2,
-                       real& M12, real& M21) const {
+    real Inverse(real lat1, real lon1, real lat2, real lon2,
+                 real& s12, real& azi1, real& azi2,
+                 real& M12, real& M21) const {
       real t;
       return GenInverse(lat1, lon1, lat2, lon2,
                         DISTANCE | AZIMUTH | GEODESICSCALE,
@@ -741,9 +864,9 @@ namespace geographic_lib {
     /**
      * See the documentation for Geodesic::Inverse.
      **********************************************************************/
-    Math::real Inverse(real lat1, real lon1, real lat2, real lon2,
-                       real& s12, real& azi1, real& azi2, real& m12,
-                       real& M12, real& M21) const {
+    real Inverse(real lat1, real lon1, real lat2, real lon2,
+                 real& s12, real& azi1, real& azi2, real& m12,
+                 real& M12, real& M21) const {
       real t;
       return GenInverse(lat1, lon1, lat2, lon2,
                         DISTANCE | AZIMUTH |
@@ -788,10 +911,155 @@ namespace geographic_lib {
      * .
      * The arc length is always computed and returned as the function value.
      **********************************************************************/
-    Math::real GenInverse(real lat1, real lon1, real lat2, real lon2,
-                          unsigned outmask,
-                          real& s12, real& azi1, real& azi2,
-                          real& m12, real& M12, real& M21, real& S12) const;
+    real GenInverse(real lat1, real lon1, real lat2, real lon2,
+                    unsigned outmask,
+                    real& s12, real& azi1, real& azi2,
+                    real& m12, real& M12, real& M21, real& S12) const;
+    ///@}
+
+    /** \name Batch version of inverse geodesic solution.
+     **********************************************************************/
+    ///@{
+    /**
+     * Solve the inverse geodesic problem for many pairs of points.
+     *
+     * @param[in] n the number of pairs of points.
+     * @param[in] lat1 array of \e n latitudes of point 1 (degrees).
+     * @param[in] lon1 array of \e n longitudes of point 1 (degrees).
+     * @param[in] lat2 array of \e n latitudes of point 2 (degrees).
+     * @param[in] lon2 array of \e n longitudes of point 2 (degrees).
+     * @param[in] outmask a bitor'ed combination of Geodesic::mask values
+     *   specifying which of the following arrays should be set.
+     * @param[out] a12 array of \e n arc lengths between point 1 and point 2
+     *   (degrees).
+     * @param[out] s12 array of \e n distances between point 1 and point 2
+     *   (meters).
+     * @param[out] azi1 array of \e n azimuths at point 1 (degrees).
+     * @param[out] azi2 array of \e n (forward) azimuths at point 2 (degrees).
+     * @param[out] m12 array of \e n reduced lengths of geodesic (meters).
+     * @param[out] M12 array of \e n geodesic scales of point 2 relative to
+     *   point 1 (dimensionless).
+     * @param[out] M21 array of \e n geodesic scales of point 1 relative to
+     *   point 2 (dimensionless).
+     * @param[out] S12 array of \e n areas under the geodesic
+     *   (meters<sup>2</sup>).
+     *
+     * The input and output arrays are stored as a "structure of arrays", so
+     * that element \e i of each output array is the result for element \e i
+     * of the input arrays.  The results are identical to calling
+     * Geodesic::GenInverse \e n times.  However, if the same latitude appears
+     * in consecutive entries of \e lat1 (or of \e lat2), e.g., for the
+     * distances from one point to many or along a row of a grid, then the
+     * terms depending only on that latitude are computed once (as for
+     * GeodesicPointT).  Output arrays which are not requested via \e
+     * outmask are not referenced and may be null pointers; \e a12 is always
+     * computed, but it is only stored if \e a12 is not null.  No memory is
+     * allocated by this function.
+     *
+     * The Geodesic::mask values possible for \e outmask are the same as for
+     * Geodesic::GenInverse.
+     **********************************************************************/
+    void InverseBatch(size_t n,
+                      const real lat1[], const real lon1[],
+                      const real lat2[], const real lon2[],
+                      unsigned outmask, real a12[],
+                      real s12[], real azi1[], real azi2[],
+                      real m12[], real M12[], real M21[], real S12[]) const;
+
+    /**
+     * See the documentation for Geodesic::InverseBatch.
+     **********************************************************************/
+    void InverseBatch(size_t n,
+                      const real lat1[], const real lon1[],
+                      const real lat2[], const real lon2[],
+                      real s12[]) const {
+      InverseBatch(n, lat1, lon1, lat2, lon2, DISTANCE,
+                   0, s12, 0, 0, 0, 0, 0, 0);
+    }
+
+    /**
+     * See the documentation for Geodesic::InverseBatch.
+     **********************************************************************/
+    void InverseBatch(size_t n,
+                      const real lat1[], const real lon1[],
+                      const real lat2[], const real lon2[],
+                      real s12[], real azi1[], real azi2[]) const {
+      InverseBatch(n, lat1, lon1, lat2, lon2, DISTANCE | AZIMUTH,
+                   0, s12, azi1, azi2, 0, 0, 0, 0);
+    }
+    ///@}
+
+    /** \name Inverse geodesic problem between prepared points.
+     **********************************************************************/
+    ///@{
+    /**
+     * The general inverse geodesic calculation between two GeodesicPointT
+     * objects.
+     *
+     * @param[in] p1 point 1; this must have been constructed with this
+     *   Geodesic object (or one with the same \e a and \e f).
+     * @param[in] p2 point 2; likewise.
+     * @param[in] outmask a bitor'ed combination of Geodesic::mask values
+     *   specifying which of the following parameters should be set.
+     * @param[out] s12 distance between point 1 and point 2 (meters).
+     * @param[out] azi1 azimuth at point 1 (degrees).
+     * @param[out] azi2 (forward) azimuth at point 2 (degrees).
+     * @param[out] m12 reduced length of geodesic (meters).
+     * @param[out] M12 geodesic scale of point 2 relative to point 1
+     *   (dimensionless).
+     * @param[out] M21 geodesic scale of point 1 relative to point 2
+     *   (dimensionless).
+     * @param[out] S12 area under the geodesic (meters<sup>2</sup>).
+     * @return \e a12 arc length of between point 1 and point 2 (degrees).
+     *
+     * This gives results identical to Geodesic::GenInverse called with the
+     * latitudes and longitudes of the points.  However, the terms which
+     * depend on only one of the latitudes are taken from \e p1 and \e p2
+     * instead of being computed.  This saves time when a point appears in
+     * many inverse problems.
+     **********************************************************************/
+    real GenInverse(const GeodesicPointT<T>& p1, const GeodesicPointT<T>& p2,
+                    unsigned outmask,
+                    real& s12, real& azi1, real& azi2,
+                    real& m12, real& M12, real& M21, real& S12) const;
+
+    /**
+     * Solve the inverse geodesic problem between two prepared points.
+     *
+     * @param[in] p1 point 1.
+     * @param[in] p2 point 2.
+     * @param[out] s12 distance between point 1 and point 2 (meters).
+     * @return \e a12 arc length of between point 1 and point 2 (degrees).
+     *
+     * See the documentation for Geodesic::GenInverse(const GeodesicPointT&,
+     * const GeodesicPointT&, ...).
+     **********************************************************************/
+    real Inverse(const GeodesicPointT<T>& p1, const GeodesicPointT<T>& p2,
+                 real& s12) const {
+      real t;
+      return GenInverse(p1, p2, DISTANCE, s12, t, t, t, t, t, t);
+    }
+
+    /**
+     * See the documentation for Geodesic::Inverse(const GeodesicPointT&,
+     * const GeodesicPointT&, real&).
+     **********************************************************************/
+    real Inverse(const GeodesicPointT<T>& p1, const GeodesicPointT<T>& p2,
+                 real& azi1, real& azi2) const {
+      real t;
+      return GenInverse(p1, p2, AZIMUTH, t, azi1, azi2, t, t, t, t);
+    }
+
+    /**
+     * See the documentation for Geodesic::Inverse(const GeodesicPointT&,
+     * const GeodesicPointT&, real&).
+     **********************************************************************/
+    real Inverse(const GeodesicPointT<T>& p1, const GeodesicPointT<T>& p2,
+                 real& s12, real& azi1, real& azi2) const {
+      real t;
+      return GenInverse(p1, p2, DISTANCE | AZIMUTH,
+                        s12, azi1, azi2, t, t, t, t);
+    }
     ///@}
 
     /** \name Interface to GeodesicLine.
@@ -834,8 +1102,8 @@ namespace geographic_lib {
      * fixed, writing \e lat1 = &plusmn;(90 &minus; &epsilon;), and taking the
      * limit &epsilon; &rarr; 0+.
      **********************************************************************/
-    GeodesicLine Line(real lat1, real lon1, real azi1, unsigned caps = ALL)
-      const;
+    GeodesicLineT<T> Line(real lat1, real lon1, real azi1,
+                          unsigned caps = ALL) const;
 
     /**
      * Define a GeodesicLine in terms of the inverse geodesic problem.
@@ -855,8 +1123,9 @@ namespace geographic_lib {
      *
      * \e lat1 and \e lat2 should be in the range [&minus;90&deg;, 90&deg;].
      **********************************************************************/
-    GeodesicLine InverseLine(real lat1, real lon1, real lat2, real lon2,
-                             unsigned caps = ALL) const;
+    GeodesicLineT<T> InverseLine(real lat1, real lon1,
+                                 real lat2, real lon2,
+                                 unsigned caps = ALL) const;
 
     /**
      * Define a GeodesicLine in terms of the direct geodesic problem specified
@@ -878,8 +1147,8 @@ namespace geographic_lib {
      *
      * \e lat1 should be in the range [&minus;90&deg;, 90&deg;].
      **********************************************************************/
-    GeodesicLine DirectLine(real lat1, real lon1, real azi1, real s12,
-                            unsigned caps = ALL) const;
+    GeodesicLineT<T> DirectLine(real lat1, real lon1, real azi1, real s12,
+                                unsigned caps = ALL) const;
 
     /**
      * Define a GeodesicLine in terms of the direct geodesic problem specified
@@ -901,8 +1170,8 @@ namespace geographic_lib {
      *
      * \e lat1 should be in the range [&minus;90&deg;, 90&deg;].
      **********************************************************************/
-    GeodesicLine ArcDirectLine(real lat1, real lon1, real azi1, real a12,
-                               unsigned caps = ALL) const;
+    GeodesicLineT<T> ArcDirectLine(real lat1, real lon1, real azi1,
+                                   real a12, unsigned caps = ALL) const;
 
     /**
      * Define a GeodesicLine in terms of the direct geodesic problem specified
@@ -927,9 +1196,9 @@ namespace geographic_lib {
      *
      * \e lat1 should be in the range [&minus;90&deg;, 90&deg;].
      **********************************************************************/
-    GeodesicLine GenDirectLine(real lat1, real lon1, real azi1,
-                               bool arcmode, real s12_a12,
-                               unsigned caps = ALL) const;
+    GeodesicLineT<T> GenDirectLine(real lat1, real lon1, real azi1,
+                                   bool arcmode, real s12_a12,
+                                   unsigned caps = ALL) const;
     ///@}
 
     /** \name Inspector functions.
@@ -940,13 +1209,13 @@ namespace geographic_lib {
      * @return \e a the equatorial radius of the ellipsoid (meters).  This is
      *   the value used in the constructor.
      **********************************************************************/
-    Math::real MajorRadius() const { return _a; }
+    real MajorRadius() const { return _a; }
 
     /**
      * @return \e f the  flattening of the ellipsoid.  This is the
      *   value used in the constructor.
      **********************************************************************/
-    Math::real Flattening() const { return _f; }
+    real Flattening() const { return _f; }
 
     /**
      * @return total area of ellipsoid in meters<sup>2</sup>.  The area of a
@@ -954,18 +1223,139 @@ namespace geographic_lib {
      *   Geodesic::EllipsoidArea()/2 to the sum of \e S12 for each side of the
      *   polygon.
      **********************************************************************/
-    Math::real EllipsoidArea() const
-    { return 4 * Math::pi() * _c2; }
+    real EllipsoidArea() const
+    { return 4 * Math::pi<real>() * _c2; }
     ///@}
 
     /**
      * A global instantiation of Geodesic with the parameters for the WGS84
      * ellipsoid.
+     *
+     * The object is constructed on the first call; this is a one-time
+     * evaluation of the coefficients of the series for the WGS84 ellipsoid.
+     * Subsequent calls merely check that the object exists.  Nevertheless, in
+     * tight loops it is better to call this once and to hold on to the
+     * returned reference.
+     **********************************************************************/
+    static const GeodesicT& WGS84();
+
+    /** \name Statistics on the inverse problem.
+     **********************************************************************/
+    ///@{
+    /**
+     * @return a snapshot of the GeodesicStatistics accumulated by all the
+     *   GeodesicT objects (with this \e T) in the calling thread since the
+     *   thread started or since the last call to
+     *   Geodesic::ResetStatistics.
+     *
+     * All the counts are zero unless the library was compiled with
+     * GEOGRAPHICLIB_GEODESIC_STATISTICS = 1.
+     **********************************************************************/
+    static GeodesicStatistics Statistics();
+
+    /**
+     * Reset the GeodesicStatistics for the calling thread.
+     **********************************************************************/
+    static void ResetStatistics();
+    ///@}
+
+  };
+
+  /**
+   * \brief A point prepared for repeated inverse geodesic calculations
+   *
+   * This holds the latitude and longitude of a point together with the
+   * terms in the solution of the inverse geodesic problem which depend only
+   * on the latitude of the point.  It is used with
+   * Geodesic::GenInverse(const GeodesicPointT&, const GeodesicPointT&, ...)
+   * and the corresponding Geodesic::Inverse functions; when a point appears
+   * in many inverse problems (e.g., when finding the nearest of many
+   * destinations), the terms are then only computed once.
+   *
+   * The object is small (9 reals) and contains no pointers; the default copy
+   * constructor and assignment operators work with this class.  The object
+   * depends on the ellipsoid, so it must only be used with the GeodesicT
+   * object used to construct it (or with one with the same \e a and \e f).
+   *
+   * GeodesicPoint (\e T = Math::real) and GeodesicPointF (\e T = float) are
+   * the versions which go with Geodesic and GeodesicF.
+   **********************************************************************/
+  template<typename T>
+  class GeodesicPointT {
+  private:
+    typedef T real;
+    friend class GeodesicT<T>;
+    real _lat, _lon, _rl[GeodesicT<T>::nrl_];
+  public:
+
+    /**
+     * Constructor for a GeodesicPointT.
+     *
+     * @param[in] g the GeodesicT object with which this point is to be used.
+     * @param[in] lat latitude of the point (degrees).
+     * @param[in] lon longitude of the point (degrees).
+     *
+     * \e lat should be in the range [&minus;90&deg;, 90&deg;].
+     **********************************************************************/
+    GeodesicPointT(const GeodesicT<T>& g, real lat, real lon)
+      : _lat(lat)
+      , _lon(lon)
+    { g.InverseTerms(_lat, _rl); }
+
+    /**
+     * A default constructor.  Inverse geodesic calculations using the
+     * resulting object return NaNs.
+     **********************************************************************/
+    GeodesicPointT()
+      : _lat(Math::NaN<real>())
+      , _lon(Math::NaN<real>())
+    { std::fill(_rl, _rl + GeodesicT<T>::nrl_, Math::NaN<real>()); }
+
+    /**
+     * @return the latitude of the point (degrees).
      **********************************************************************/
-    static const Geodesic& WGS84();
+    real Latitude() const { return _lat; }
 
+    /**
+     * @return the longitude of the point (degrees).
+     **********************************************************************/
+    real Longitude() const { return _lon; }
   };
 
+  /**
+   * @relates GeodesicT
+   * Geodesic calculations using Math::real.  Because this is a typedef, it
+   * cannot be forward declared with "class Geodesic;"; include this header
+   * instead.
+   **********************************************************************/
+  typedef GeodesicT<Math::real> Geodesic;
+
+  /**
+   * @relates GeodesicT
+   * Geodesic calculations using float.
+   **********************************************************************/
+  typedef GeodesicT<float> GeodesicF;
+
+  /// \cond SKIP
+  // The instantiations are compiled into (and exported from) the library.
+  extern template class GEOGRAPHICLIB_EXPORT GeodesicT<Math::real>;
+#if GEOGRAPHICLIB_PRECISION != 1
+  extern template class GEOGRAPHICLIB_EXPORT GeodesicT<float>;
+#endif
+  /// \endcond
+
+  /**
+   * @relates GeodesicPointT
+   * Prepared points for Geodesic.
+   **********************************************************************/
+  typedef GeodesicPointT<Math::real> GeodesicPoint;
+
+  /**
+   * @relates GeodesicPointT
+   * Prepared points for GeodesicF.
+   **********************************************************************/
+  typedef GeodesicPointT<float> GeodesicPointF;
+
 } // namespace geographic_lib
 
 #endif  // GEOGRAPHICLIB_GEODESIC_HPP
@@ -0,0 +1,199 @@
+/**
+ * \file GeodesicDistanceMatrix.hpp
+ * \brief Header for geographic_lib::GeodesicDistanceMatrixT class
+ *
+ * Copyright (c) 2026 the geographic_lib authors and licensed under the
+ * MIT/X11 License.  This file is not part of the upstream GeographicLib
+ * distribution; see https://geographiclib.sourceforge.io/ for that.
+ **********************************************************************/
+
+#if !defined(GEOGRAPHICLIB_GEODESICDISTANCEMATRIX_HPP)
+#define GEOGRAPHICLIB_GEODESICDISTANCEMATRIX_HPP 1
+
+#include <geographic_lib/Geodesic.hpp>
+
+namespace geographic_lib {
+
+  /**
+   * \brief Matrices of geodesic distances
+   *
+   * This solves the inverse geodesic problem between every one of \e n
+   * points 1 and every one of \e m points 2, filling \e n &times; \e m
+   * matrices of distances and (optionally) azimuths.  The results are
+   * identical to calling Geodesic::Inverse for each pair of points, but the
+   * terms which depend only on the latitude of a point (the sine and cosine
+   * of the reduced latitude, etc.) are computed once per point, as a
+   * GeodesicPointT, instead of once per pair.
+   *
+   * The matrix is computed in tiles of \e rowtile &times; \e coltile
+   * elements (specified in the constructor) so that the data for the points
+   * in a tile stays in the cache.  If the library is compiled with OpenMP
+   * enabled (e.g., by configuring with cmake -D USE_OPENMP=ON), the tiles are
+   * handed out dynamically to the threads of an OpenMP team, so that threads
+   * which finish their tiles early take more.  The number of threads is then
+   * controlled in the usual way, e.g., with the OMP_NUM_THREADS environment
+   * variable.  Otherwise the tiles are computed sequentially.
+   *
+   * This is a templated class; GeodesicDistanceMatrix (\e T = Math::real) and
+   * GeodesicDistanceMatrixF (\e T = float) are the versions which go with
+   * Geodesic and GeodesicF.
+   *
+   * Example of use:
+   * \include example-GeodesicDistanceMatrix.cpp
+   **********************************************************************/
+
+  template<typename T>
+  class GeodesicDistanceMatrixT {
+  private:
+    typedef T real;
+    GeodesicT<T> _earth;
+    int _rowtile, _coltile;
+
+  public:
+
+    /**
+     * Bit masks for what calculations to do.  These are a subset of
+     * Geodesic::mask.
+     **********************************************************************/
+    enum mask {
+      /**
+       * No output.
+       * @hideinitializer
+       **********************************************************************/
+      NONE          = GeodesicT<T>::NONE,
+      /**
+       * Calculate distance \e s12.
+       * @hideinitializer
+       **********************************************************************/
+      DISTANCE      = GeodesicT<T>::DISTANCE,
+      /**
+       * Calculate azimuths \e azi1 and \e azi2.
+       * @hideinitializer
+       **********************************************************************/
+      AZIMUTH       = GeodesicT<T>::AZIMUTH,
+      /**
+       * Calculate everything.
+       * @hideinitializer
+       **********************************************************************/
+      ALL           = DISTANCE | AZIMUTH,
+    };
+
+    /**
+     * Constructor for GeodesicDistanceMatrixT.
+     *
+     * @param[in] earth the GeodesicT object to use for the calculations.
+     * @param[in] rowtile the number of rows in a tile (default 16).
+     * @param[in] coltile the number of columns in a tile (default 256).
+     * @exception GeographicErr if \e rowtile or \e coltile is not positive.
+     *
+     * The defaults result in the data for the points in a tile occupying
+     * about 16 kB in double precision.
+     **********************************************************************/
+    GeodesicDistanceMatrixT(const GeodesicT<T>& earth,
+                            int rowtile = 16, int coltile = 256);
+
+    /**
+     * Compute a matrix of distances and azimuths.
+     *
+     * @param[in] n the number of points 1 (the rows of the matrix).
+     * @param[in] lat1 array of \e n latitudes of point 1 (degrees).
+     * @param[in] lon1 array of \e n longitudes of point 1 (degrees).
+     * @param[in] m the number of points 2 (the columns of the matrix).
+     * @param[in] lat2 array of \e m latitudes of point 2 (degrees).
+     * @param[in] lon2 array of \e m longitudes of point 2 (degrees).
+     * @param[in] outmask a bitor'ed combination of
+     *   GeodesicDistanceMatrixT::mask values specifying which of the following
+     *   arrays should be set.
+     * @param[out] s12 array of \e n &times; \e m distances between point 1
+     *   and point 2 (meters).
+     * @param[out] azi1 array of \e n &times; \e m azimuths at point 1
+     *   (degrees).
+     * @param[out] azi2 array of \e n &times; \e m (forward) azimuths at point
+     *   2 (degrees).
+     *
+     * The output arrays are in row-major order; the results for lat1[\e i],
+     * lon1[\e i] and lat2[\e j], lon2[\e j] are stored in element \e i \e m
+     * + \e j.  Arrays corresponding to outputs not requested in \e outmask
+     * may be null.  Asking only for GeodesicDistanceMatrixT::DISTANCE gives
+     * the fastest calculation.
+     **********************************************************************/
+    void Compute(size_t n, const real lat1[], const real lon1[],
+                 size_t m, const real lat2[], const real lon2[],
+                 unsigned outmask,
+                 real s12[], real azi1[], real azi2[]) const;
+
+    /**
+     * Compute a matrix of distances.
+     *
+     * @param[in] n the number of points 1.
+     * @param[in] lat1 array of \e n latitudes of point 1 (degrees).
+     * @param[in] lon1 array of \e n longitudes of point 1 (degrees).
+     * @param[in] m the number of points 2.
+     * @param[in] lat2 array of \e m latitudes of point 2 (degrees).
+     * @param[in] lon2 array of \e m longitudes of point 2 (degrees).
+     * @param[out] s12 array of \e n &times; \e m distances between point 1
+     *   and point 2 (meters), in row-major order.
+     **********************************************************************/
+    void Distances(size_t n, const real lat1[], const real lon1[],
+                   size_t m, const real lat2[], const real lon2[],
+                   real s12[]) const
+    { Compute(n, lat1, lon1, m, lat2, lon2, DISTANCE, s12, 0, 0); }
+
+    /** \name Inspector functions
+     **********************************************************************/
+    ///@{
+    /**
+     * @return \e a the equatorial radius of the ellipsoid (meters).  This is
+     *   the value inherited from the GeodesicT object used in the constructor.
+     **********************************************************************/
+    real MajorRadius() const { return _earth.MajorRadius(); }
+
+    /**
+     * @return \e f the flattening of the ellipsoid.  This is the value
+     *   inherited from the GeodesicT object used in the constructor.
+     **********************************************************************/
+    real Flattening() const { return _earth.Flattening(); }
+
+    /**
+     * @return the number of rows in a tile.
+     **********************************************************************/
+    int RowTile() const { return _rowtile; }
+
+    /**
+     * @return the number of columns in a tile.
+     **********************************************************************/
+    int ColTile() const { return _coltile; }
+
+    /**
+     * @return the maximum number of threads that GeodesicDistanceMatrixT::
+     *   Compute will use.  This is 1 if the library was compiled without
+     *   OpenMP.
+     **********************************************************************/
+    static int MaxThreads();
+    ///@}
+  };
+
+  /**
+   * @relates GeodesicDistanceMatrixT
+   * Distance matrices using Math::real.
+   **********************************************************************/
+  typedef GeodesicDistanceMatrixT<Math::real> GeodesicDistanceMatrix;
+
+  /**
+   * @relates GeodesicDistanceMatrixT
+   * Distance matrices using float.
+   **********************************************************************/
+  typedef GeodesicDistanceMatrixT<float> GeodesicDistanceMatrixF;
+
+  /// \cond SKIP
+  // The instantiations are compiled into (and exported from) the library.
+  extern template class GEOGRAPHICLIB_EXPORT
+  GeodesicDistanceMatrixT<Math::real>;
+#if GEOGRAPHICLIB_PRECISION != 1
+  extern template class GEOGRAPHICLIB_EXPORT GeodesicDistanceMatrixT<float>;
+#endif
+  /// \endcond
+
+} // namespace geographic_lib
+
+#endif  // GEOGRAPHICLIB_GEODESICDISTANCEMATRIX_HPP
@@ -12,6 +12,10 @@
 
 #include <geographic_lib/Constants.hpp>
 #include <geographic_lib/EllipticFunction.hpp>
+#include <geographic_lib/GeodesicStatistics.hpp>
+#if GEOGRAPHICLIB_CXX11_THREADS
+#  include <atomic>
+#endif
 
 #if !defined(GEOGRAPHICLIB_GEODESICEXACT_ORDER)
 /**
@@ -20,6 +24,12 @@
 #  define GEOGRAPHICLIB_GEODESICEXACT_ORDER 30
 #endif
 
+#if defined(_MSC_VER)
+// Squelch warnings about dll vs atomic
+#  pragma warning (push)
+#  pragma warning (disable: 4251)
+#endif
+
 namespace geographic_lib {
 
   class GeodesicLineExact;
@@ -69,6 +79,19 @@ namespace geographic_lib {
    * See \ref geodellip for the formulation.  See the documentation on the
    * Geodesic class for additional information on the geodesic problems.
    *
+   * The coefficients of the series for the area are expensive to compute.
+   * So they are only computed when they are first needed, i.e., when the
+   * area is requested or when a GeodesicLineExact is constructed with
+   * GeodesicExact::AREA; a GeodesicExact object which is never used to
+   * compute areas is cheap to construct.  The coefficients are saved in a
+   * process-wide cache indexed by the flattening and subsequent objects with
+   * the same flattening copy them from the cache.  The cache can be filled
+   * ahead of time with GeodesicExact::Prewarm.  Access to the cache is
+   * serialized with a mutex so that objects can be used in several threads
+   * at once; if C++11 threads are not available (GEOGRAPHICLIB_CXX11_THREADS
+   * = 0), the cache is disabled and the coefficients are computed by the
+   * constructor.
+   *
    * Example of use:
    * \include example-GeodesicExact.cpp
    *
@@ -103,8 +126,44 @@ namespace geographic_lib {
     static real CosSeries(real sinx, real cosx, const real c[], int n);
     static real Astroid(real x, real y);
 
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+    // The statistics for this thread
+    static GeodesicStatistics& Stats();
+#endif
+
     real _a, _f, _f1, _e2, _ep2, _n, _b, _c2, _etol2;
-    real _C4x[nC4x_];
+    // The coefficients for the area, c, are only computed when they're first
+    // needed (by C4f).  If C++11 threads are available, c is set at most once
+    // by C4init (with the mutex for the cache locked) before init is set with
+    // release semantics; readers test init with acquire semantics and then
+    // read c without locking.  Otherwise c is set by the constructor.  The
+    // coefficients are only copied if they've been set, so that copying a
+    // GeodesicExact doesn't race with C4init in another thread.
+    struct C4data {
+      real c[nC4x_];
+#if GEOGRAPHICLIB_CXX11_THREADS
+      std::atomic<bool> init;
+      bool ready() const { return init.load(std::memory_order_acquire); }
+      void set() { init.store(true, std::memory_order_release); }
+#else
+      bool init;
+      bool ready() const { return init; }
+      void set() { init = true; }
+#endif
+      C4data() : init(false) {}
+      C4data(const C4data& d) : init(false) { *this = d; }
+      C4data& operator=(const C4data& d) {
+        if (this != &d) {
+          if (d.ready()) {
+            std::copy(d.c, d.c + nC4x_, c);
+            set();
+          } else
+            init = false;
+        }
+        return *this;
+      }
+    };
+    mutable C4data _c4;
 
     void Lengths(const EllipticFunction& E,
                  real sig12,
@@ -133,7 +192,9 @@ namespace geographic_lib {
 
     // These are Maxima generated functions to provide series approximations to
     // the integrals for the area.
-    void C4coeff();
+    void C4coeff(real c[]) const;
+    // Set _c4, from the cache if possible, if this hasn't been done yet
+    void C4init() const;
     void C4f(real k2, real c[]) const;
     // Large coefficients are split so that lo contains the low 52 bits and hi
     // the rest.  This choice avoids double rounding with doubles and higher
@@ -856,8 +917,67 @@ namespace geographic_lib {
      **********************************************************************/
     static const GeodesicExact& WGS84();
 
+    /** \name Statistics on the inverse problem.
+     **********************************************************************/
+    ///@{
+    /**
+     * @return a snapshot of the GeodesicStatistics accumulated by all the
+     *   GeodesicExact objects in the calling thread since the thread started
+     *   or since the last call to GeodesicExact::ResetStatistics.
+     *
+     * All the counts are zero unless the library was compiled with
+     * GEOGRAPHICLIB_GEODESIC_STATISTICS = 1.
+     **********************************************************************/
+    static GeodesicStatistics Statistics();
+
+    /**
+     * Reset the GeodesicStatistics for the calling thread.
+     **********************************************************************/
+    static void ResetStatistics();
+    ///@}
+
+    /** \name Coefficient cache.
+     **********************************************************************/
+    ///@{
+    /**
+     * Ensure that the coefficients for an ellipsoid are in the cache.
+     *
+     * @param[in] a equatorial radius (meters).
+     * @param[in] f flattening of ellipsoid.
+     * @exception GeographicErr if \e a or (1 &minus; \e f ) \e a is not
+     *   positive.
+     *
+     * Calling this at startup for each of the ellipsoids which will be used
+     * moves the cost of computing the coefficients out of the first area
+     * calculation with each new object.  Only the first
+     * GeodesicExact::MaxCacheSize() flattenings are cached.
+     **********************************************************************/
+    static void Prewarm(real a, real f);
+
+    /**
+     * Remove all the entries from the cache.  Existing GeodesicExact objects
+     * are unaffected since they hold their own copies of the coefficients.
+     **********************************************************************/
+    static void ClearCache();
+
+    /**
+     * @return the number of flattenings in the cache.
+     **********************************************************************/
+    static size_t CacheSize();
+
+    /**
+     * @return the maximum number of flattenings held in the cache (0 if the
+     *   cache is disabled).
+     **********************************************************************/
+    static size_t MaxCacheSize();
+    ///@}
+
   };
 
 } // namespace geographic_lib
 
+#if defined(_MSC_VER)
+#  pragma warning (pop)
+#endif
+
 #endif  // GEOGRAPHICLIB_GEODESICEXACT_HPP
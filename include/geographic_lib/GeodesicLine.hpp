@@ -39,6 +39,10 @@ namespace geographic_lib {
    * The default copy constructor and assignment operators work with this
    * class.  Similarly, a vector can be used to hold GeodesicLine objects.
    *
+   * This is a templated class; GeodesicLine (\e T = Math::real) and
+   * GeodesicLineF (\e T = float) are the versions which go with Geodesic and
+   * GeodesicF.
+   *
    * The calculations are accurate to better than 15 nm (15 nanometers).  See
    * Sec. 9 of
    * <a href="https://arxiv.org/abs/1102.1215v1">arXiv:1102.1215v1</a> for
@@ -68,15 +72,16 @@ namespace geographic_lib {
    * providing access to the functionality of Geodesic and GeodesicLine.
    **********************************************************************/
 
-  class GEOGRAPHICLIB_EXPORT GeodesicLine {
+  template<typename T>
+  class GeodesicLineT {
   private:
-    typedef Math::real real;
-    friend class Geodesic;
-    static const int nC1_ = Geodesic::nC1_;
-    static const int nC1p_ = Geodesic::nC1p_;
-    static const int nC2_ = Geodesic::nC2_;
-    static const int nC3_ = Geodesic::nC3_;
-    static const int nC4_ = Geodesic::nC4_;
+    typedef T real;
+    friend class GeodesicT<T>;
+    static const int nC1_ = GeodesicT<T>::nC1_;
+    static const int nC1p_ = GeodesicT<T>::nC1p_;
+    static const int nC2_ = GeodesicT<T>::nC2_;
+    static const int nC3_ = GeodesicT<T>::nC3_;
+    static const int nC4_ = GeodesicT<T>::nC4_;
 
     real tiny_;
     real _lat1, _lon1, _azi1;
@@ -89,26 +94,38 @@ namespace geographic_lib {
       _C4a[nC4_];    // all the elements of _C4a are used
     unsigned _caps;
 
-    void LineInit(const Geodesic& g,
+    void LineInit(const GeodesicT<T>& g,
+                  real lat1, real lon1,
+                  real azi1, real salp1, real calp1,
+                  unsigned caps);
+    // Version of LineInit with the reduced latitude of point 1 supplied
+    void LineInit(const GeodesicT<T>& g,
                   real lat1, real lon1,
                   real azi1, real salp1, real calp1,
+                  real sbet1, real cbet1, real dn1,
                   unsigned caps);
-    GeodesicLine(const Geodesic& g,
-                 real lat1, real lon1,
-                 real azi1, real salp1, real calp1,
-                 unsigned caps, bool arcmode, real s13_a13);
+    GeodesicLineT(const GeodesicT<T>& g,
+                  real lat1, real lon1,
+                  real azi1, real salp1, real calp1,
+                  unsigned caps, bool arcmode, real s13_a13);
+    // The number of points computed together by GenPositions
+    static const int lanes_ = 8;
+    // GeodesicT<T>::SinCosSeries for lanes_ angles
+    static void SinCosSeriesBlock(bool sinp,
+                                  const real sinx[], const real cosx[],
+                                  const real c[], int n, real y[]);
 
     enum captype {
-      CAP_NONE = Geodesic::CAP_NONE,
-      CAP_C1   = Geodesic::CAP_C1,
-      CAP_C1p  = Geodesic::CAP_C1p,
-      CAP_C2   = Geodesic::CAP_C2,
-      CAP_C3   = Geodesic::CAP_C3,
-      CAP_C4   = Geodesic::CAP_C4,
-      CAP_ALL  = Geodesic::CAP_ALL,
-      CAP_MASK = Geodesic::CAP_MASK,
-      OUT_ALL  = Geodesic::OUT_ALL,
-      OUT_MASK = Geodesic::OUT_MASK,
+      CAP_NONE = GeodesicT<T>::CAP_NONE,
+      CAP_C1   = GeodesicT<T>::CAP_C1,
+      CAP_C1p  = GeodesicT<T>::CAP_C1p,
+      CAP_C2   = GeodesicT<T>::CAP_C2,
+      CAP_C3   = GeodesicT<T>::CAP_C3,
+      CAP_C4   = GeodesicT<T>::CAP_C4,
+      CAP_ALL  = GeodesicT<T>::CAP_ALL,
+      CAP_MASK = GeodesicT<T>::CAP_MASK,
+      OUT_ALL  = GeodesicT<T>::OUT_ALL,
+      OUT_MASK = GeodesicT<T>::OUT_MASK,
     };
   public:
 
@@ -123,62 +140,62 @@ namespace geographic_lib {
        * No capabilities, no output.
        * @hideinitializer
        **********************************************************************/
-      NONE          = Geodesic::NONE,
+      NONE          = GeodesicT<T>::NONE,
       /**
        * Calculate latitude \e lat2.  (It's not necessary to include this as a
        * capability to GeodesicLine because this is included by default.)
        * @hideinitializer
        **********************************************************************/
-      LATITUDE      = Geodesic::LATITUDE,
+      LATITUDE      = GeodesicT<T>::LATITUDE,
       /**
        * Calculate longitude \e lon2.
        * @hideinitializer
        **********************************************************************/
-      LONGITUDE     = Geodesic::LONGITUDE,
+      LONGITUDE     = GeodesicT<T>::LONGITUDE,
       /**
        * Calculate azimuths \e azi1 and \e azi2.  (It's not necessary to
        * include this as a capability to GeodesicLine because this is included
        * by default.)
        * @hideinitializer
        **********************************************************************/
-      AZIMUTH       = Geodesic::AZIMUTH,
+      AZIMUTH       = GeodesicT<T>::AZIMUTH,
       /**
        * Calculate distance \e s12.
        * @hideinitializer
        **********************************************************************/
-      DISTANCE      = Geodesic::DISTANCE,
+      DISTANCE      = GeodesicT<T>::DISTANCE,
       /**
        * Allow distance \e s12 to be used as input in the direct geodesic
        * problem.
        * @hideinitializer
        **********************************************************************/
-      DISTANCE_IN   = Geodesic::DISTANCE_IN,
+      DISTANCE_IN   = GeodesicT<T>::DISTANCE_IN,
       /**
        * Calculate reduced length \e m12.
        * @hideinitializer
        **********************************************************************/
-      REDUCEDLENGTH = Geodesic::REDUCEDLENGTH,
+      REDUCEDLENGTH = GeodesicT<T>::REDUCEDLENGTH,
       /**
        * Calculate geodesic scales \e M12 and \e M21.
        * @hideinitializer
        **********************************************************************/
-      GEODESICSCALE = Geodesic::GEODESICSCALE,
+      GEODESICSCALE = GeodesicT<T>::GEODESICSCALE,
       /**
        * Calculate area \e S12.
        * @hideinitializer
        **********************************************************************/
-      AREA          = Geodesic::AREA,
+      AREA          = GeodesicT<T>::AREA,
       /**
        * Unroll \e lon2 in the direct calculation.
        * @hideinitializer
        **********************************************************************/
-      LONG_UNROLL   = Geodesic::LONG_UNROLL,
+      LONG_UNROLL   = GeodesicT<T>::LONG_UNROLL,
       /**
        * All capabilities, calculate everything.  (LONG_UNROLL is not
        * included in this mask.)
        * @hideinitializer
        **********************************************************************/
-      ALL           = Geodesic::ALL,
+      ALL           = GeodesicT<T>::ALL,
     };
 
     /** \name Constructors
@@ -223,8 +240,8 @@ namespace geographic_lib {
      * fixed, writing \e lat1 = &plusmn;(90&deg; &minus; &epsilon;), and taking
      * the limit &epsilon; &rarr; 0+.
      **********************************************************************/
-    GeodesicLine(const Geodesic& g, real lat1, real lon1, real azi1,
-                 unsigned caps = ALL);
+    GeodesicLineT(const GeodesicT<T>& g, real lat1, real lon1, real azi1,
+                  unsigned caps = ALL);
 
     /**
      * A default constructor.  If GeodesicLine::Position is called on the
@@ -232,7 +249,7 @@ namespace geographic_lib {
      * calculations).  The object can be set with a call to Geodesic::Line.
      * Use Init() to test whether object is still in this uninitialized state.
      **********************************************************************/
-    GeodesicLine() : _caps(0U) {}
+    GeodesicLineT() : _caps(0U) {}
     ///@}
 
     /** \name Position in terms of distance
@@ -278,10 +295,10 @@ namespace geographic_lib {
      * however, that the arc length is always computed and returned as the
      * function value.
      **********************************************************************/
-    Math::real Position(real s12,
-                        real& lat2, real& lon2, real& azi2,
-                        real& m12, real& M12, real& M21,
-                        real& S12) const {
+    real Position(real s12,
+                  real& lat2, real& lon2, real& azi2,
+                  real& m12, real& M12, real& M21,
+                  real& S12) const {
       real t;
       return GenPosition(false, s12,
                          LATITUDE | LONGITUDE | AZIMUTH |
@@ -292,7 +309,7 @@ namespace geographic_lib {
     /**
      * See the documentation for GeodesicLine::Position.
      **********************************************************************/
-    Math::real Position(real s12, real& lat2, real& lon2) const {
+    real Position(real s12, real& lat2, real& lon2) const {
       real t;
       return GenPosition(false, s12,
                          LATITUDE | LONGITUDE,
@@ -302,8 +319,8 @@ namespace geographic_lib {
     /**
      * See the documentation for GeodesicLine::Position.
      **********************************************************************/
-    Math::real Position(real s12, real& lat2, real& lon2,
-                        real& azi2) const {
+    real Position(real s12, real& lat2, real& lon2,
+                  real& azi2) const {
       real t;
       return GenPosition(false, s12,
                          LATITUDE | LONGITUDE | AZIMUTH,
@@ -313,8 +330,8 @@ namespace geographic_lib {
     /**
      * See the documentation for GeodesicLine::Position.
      **********************************************************************/
-    Math::real Position(real s12, real& lat2, real& lon2,
-                        real& azi2, real& m12) const {
+    real Position(real s12, real& lat2, real& lon2,
+                  real& azi2, real& m12) const {
       real t;
       return GenPosition(false, s12,
                          LATITUDE | LONGITUDE |
@@ -325,8 +342,8 @@ namespace geographic_lib {
     /**
      * See the documentation for GeodesicLine::Position.
      **********************************************************************/
-    Math::real Position(real s12, real& lat2, real& lon2,
-                        real& azi2, real& M12, real& M21)
+    real Position(real s12, real& lat2, real& lon2,
+                  real& azi2, real& M12, real& M21)
       const {
       real t;
       return GenPosition(false, s12,
@@ -338,9 +355,9 @@ namespace geographic_lib {
     /**
      * See the documentation for GeodesicLine::Position.
      **********************************************************************/
-    Math::real Position(real s12,
-                        real& lat2, real& lon2, real& azi2,
-                        real& m12, real& M12, real& M21)
+    real Position(real s12,
+                  real& lat2, real& lon2, real& azi2,
+                  real& m12, real& M12, real& M21)
       const {
       real t;
       return GenPosition(false, s12,
@@ -534,10 +551,120 @@ namespace geographic_lib {
      * \e lon1 indicates how many times and in what sense the geodesic
      * encircles the ellipsoid.
      **********************************************************************/
-    Math::real GenPosition(bool arcmode, real s12_a12, unsigned outmask,
-                           real& lat2, real& lon2, real& azi2,
-                           real& s12, real& m12, real& M12, real& M21,
-                           real& S12) const;
+    real GenPosition(bool arcmode, real s12_a12, unsigned outmask,
+                     real& lat2, real& lon2, real& azi2,
+                     real& s12, real& m12, real& M12, real& M21,
+                     real& S12) const;
+    ///@}
+
+    /** \name Positions of many points
+     **********************************************************************/
+    ///@{
+
+    /**
+     * The general position function applied to many points on the geodesic.
+     *
+     * @param[in] arcmode boolean flag determining the meaning of the entries
+     *   of \e s12_a12; if \e arcmode is false, then the GeodesicLine object
+     *   must have been constructed with \e caps |= GeodesicLine::DISTANCE_IN.
+     * @param[in] n the number of points.
+     * @param[in] s12_a12 array of \e n distances from point 1 to point 2
+     *   (meters), if \e arcmode is false; otherwise array of \e n arc lengths
+     *   from point 1 to point 2 (degrees).
+     * @param[in] outmask a bitor'ed combination of GeodesicLine::mask values
+     *   specifying which of the following arrays should be set.
+     * @param[out] a12 array of \e n arc lengths from point 1 to point 2
+     *   (degrees).
+     * @param[out] lat2 array of \e n latitudes of point 2 (degrees).
+     * @param[out] lon2 array of \e n longitudes of point 2 (degrees).
+     * @param[out] azi2 array of \e n (forward) azimuths at point 2 (degrees).
+     * @param[out] s12 array of \e n distances from point 1 to point 2
+     *   (meters).
+     * @param[out] m12 array of \e n reduced lengths of geodesic (meters).
+     * @param[out] M12 array of \e n geodesic scales of point 2 relative to
+     *   point 1 (dimensionless).
+     * @param[out] M21 array of \e n geodesic scales of point 1 relative to
+     *   point 2 (dimensionless).
+     * @param[out] S12 array of \e n areas under the geodesic
+     *   (meters<sup>2</sup>).
+     *
+     * This gives the same results as \e n calls to GeodesicLine::GenPosition.
+     * However, the points are computed in blocks of 8 and, within a block,
+     * each step of the calculation (in particular, the Clenshaw summation of
+     * the series for the distance, the longitude, the reduced length, and
+     * the area) is carried out for all the points together; this allows the
+     * compiler to vectorize the summations.  The checks on the capabilities
+     * and on \e outmask are done once for the whole array.  Output arrays
+     * which are not requested via \e outmask (or which the GeodesicLine
+     * object is not capable of computing) are not referenced and may be null
+     * pointers; \e a12 is only stored if it is not null.  If the object is
+     * uninitialized or a distance calculation is requested without the
+     * GeodesicLine::DISTANCE_IN capability, \e a12 is set to NaN and the
+     * other arrays are not altered.
+     **********************************************************************/
+    void GenPositions(bool arcmode, size_t n, const real s12_a12[],
+                      unsigned outmask, real a12[],
+                      real lat2[], real lon2[], real azi2[],
+                      real s12[], real m12[], real M12[], real M21[],
+                      real S12[]) const;
+
+    /**
+     * Compute the positions of many points given their distances from
+     * point 1.
+     *
+     * @param[in] n the number of points.
+     * @param[in] s12 array of \e n distances from point 1 to point 2
+     *   (meters).
+     * @param[out] lat2 array of \e n latitudes of point 2 (degrees).
+     * @param[out] lon2 array of \e n longitudes of point 2 (degrees); requires
+     *   that the GeodesicLine object was constructed with \e caps |=
+     *   GeodesicLine::LONGITUDE.
+     *
+     * See GeodesicLine::GenPositions for details.
+     **********************************************************************/
+    void Positions(size_t n, const real s12[],
+                   real lat2[], real lon2[]) const {
+      GenPositions(false, n, s12, LATITUDE | LONGITUDE,
+                   0, lat2, lon2, 0, 0, 0, 0, 0, 0);
+    }
+
+    /**
+     * See the documentation for GeodesicLine::Positions.
+     **********************************************************************/
+    void Positions(size_t n, const real s12[],
+                   real lat2[], real lon2[], real azi2[]) const {
+      GenPositions(false, n, s12, LATITUDE | LONGITUDE | AZIMUTH,
+                   0, lat2, lon2, azi2, 0, 0, 0, 0, 0);
+    }
+
+    /**
+     * Compute the positions of many points given their arc lengths from
+     * point 1.
+     *
+     * @param[in] n the number of points.
+     * @param[in] a12 array of \e n arc lengths from point 1 to point 2
+     *   (degrees).
+     * @param[out] lat2 array of \e n latitudes of point 2 (degrees).
+     * @param[out] lon2 array of \e n longitudes of point 2 (degrees); requires
+     *   that the GeodesicLine object was constructed with \e caps |=
+     *   GeodesicLine::LONGITUDE.
+     *
+     * See GeodesicLine::GenPositions for details.
+     **********************************************************************/
+    void ArcPositions(size_t n, const real a12[],
+                      real lat2[], real lon2[]) const {
+      GenPositions(true, n, a12, LATITUDE | LONGITUDE,
+                   0, lat2, lon2, 0, 0, 0, 0, 0, 0);
+    }
+
+    /**
+     * See the documentation for GeodesicLine::ArcPositions.
+     **********************************************************************/
+    void ArcPositions(size_t n, const real a12[],
+                      real lat2[], real lon2[], real azi2[]) const {
+      GenPositions(true, n, a12, LATITUDE | LONGITUDE | AZIMUTH,
+                   0, lat2, lon2, azi2, 0, 0, 0, 0, 0);
+    }
     ///@}
 
     /** \name Setting point 3
@@ -591,20 +718,20 @@ namespace geographic_lib {
     /**
      * @return \e lat1 the latitude of point 1 (degrees).
      **********************************************************************/
-    Math::real Latitude() const
-    { return Init() ? _lat1 : Math::NaN(); }
+    real Latitude() const
+    { return Init() ? _lat1 : Math::NaN<real>(); }
 
     /**
      * @return \e lon1 the longitude of point 1 (degrees).
      **********************************************************************/
-    Math::real Longitude() const
-    { return Init() ? _lon1 : Math::NaN(); }
+    real Longitude() const
+    { return Init() ? _lon1 : Math::NaN<real>(); }
 
     /**
      * @return \e azi1 the azimuth (degrees) of the geodesic line at point 1.
      **********************************************************************/
-    Math::real Azimuth() const
-    { return Init() ? _azi1 : Math::NaN(); }
+    real Azimuth() const
+    { return Init() ? _azi1 : Math::NaN<real>(); }
 
     /**
      * The sine and cosine of \e azi1.
@@ -621,8 +748,8 @@ namespace geographic_lib {
      *
      * The result lies in [&minus;90&deg;, 90&deg;].
      **********************************************************************/
-    Math::real EquatorialAzimuth() const
-    { return Init() ? Math::atan2d(_salp0, _calp0) : Math::NaN(); }
+    real EquatorialAzimuth() const
+    { return Init() ? Math::atan2d(_salp0, _calp0) : Math::NaN<real>(); }
 
     /**
      * The sine and cosine of \e azi0.
@@ -639,23 +766,23 @@ namespace geographic_lib {
      *
      * The result lies in (&minus;180&deg;, 180&deg;].
      **********************************************************************/
-    Math::real EquatorialArc() const {
-      return Init() ? Math::atan2d(_ssig1, _csig1) : Math::NaN();
+    real EquatorialArc() const {
+      return Init() ? Math::atan2d(_ssig1, _csig1) : Math::NaN<real>();
     }
 
     /**
      * @return \e a the equatorial radius of the ellipsoid (meters).  This is
      *   the value inherited from the Geodesic object used in the constructor.
      **********************************************************************/
-    Math::real MajorRadius() const
-    { return Init() ? _a : Math::NaN(); }
+    real MajorRadius() const
+    { return Init() ? _a : Math::NaN<real>(); }
 
     /**
      * @return \e f the flattening of the ellipsoid.  This is the value
      *   inherited from the Geodesic object used in the constructor.
      **********************************************************************/
-    Math::real Flattening() const
-    { return Init() ? _f : Math::NaN(); }
+    real Flattening() const
+    { return Init() ? _f : Math::NaN<real>(); }
 
     /**
      * @return \e caps the computational capabilities that this object was
@@ -681,22 +808,44 @@ namespace geographic_lib {
      *   value.
      * @return \e s13 if \e arcmode is false; \e a13 if \e arcmode is true.
      **********************************************************************/
-    Math::real GenDistance(bool arcmode) const
-    { return Init() ? (arcmode ? _a13 : _s13) : Math::NaN(); }
+    real GenDistance(bool arcmode) const
+    { return Init() ? (arcmode ? _a13 : _s13) : Math::NaN<real>(); }
 
     /**
      * @return \e s13, the distance to point 3 (meters).
      **********************************************************************/
-    Math::real Distance() const { return GenDistance(false); }
+    real Distance() const { return GenDistance(false); }
 
     /**
      * @return \e a13, the arc length to point 3 (degrees).
      **********************************************************************/
-    Math::real Arc() const { return GenDistance(true); }
+    real Arc() const { return GenDistance(true); }
     ///@}
 
   };
 
+  /**
+   * @relates GeodesicLineT
+   * A geodesic line using Math::real.  Because this is a typedef, it cannot
+   * be forward declared with "class GeodesicLine;"; include this header
+   * instead.
+   **********************************************************************/
+  typedef GeodesicLineT<Math::real> GeodesicLine;
+
+  /**
+   * @relates GeodesicLineT
+   * A geodesic line using float.
+   **********************************************************************/
+  typedef GeodesicLineT<float> GeodesicLineF;
+
+  /// \cond SKIP
+  // The instantiations are compiled into (and exported from) the library.
+  extern template class GEOGRAPHICLIB_EXPORT GeodesicLineT<Math::real>;
+#if GEOGRAPHICLIB_PRECISION != 1
+  extern template class GEOGRAPHICLIB_EXPORT GeodesicLineT<float>;
+#endif
+  /// \endcond
+
 } // namespace geographic_lib
 
 #endif  // GEOGRAPHICLIB_GEODESICLINE_HPP
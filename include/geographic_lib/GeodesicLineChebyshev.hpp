@@ -0,0 +1,336 @@
+/**
+ * \file GeodesicLineChebyshev.hpp
+ * \brief Header for geographic_lib::GeodesicLineChebyshev class
+ *
+ * Copyright (c) 2026 the geographic_lib authors and licensed under the
+ * MIT/X11 License.  This file is not part of the upstream GeographicLib
+ * distribution; see https://geographiclib.sourceforge.io/ for that.
+ **********************************************************************/
+
+#if !defined(GEOGRAPHICLIB_GEODESICLINECHEBYSHEV_HPP)
+#define GEOGRAPHICLIB_GEODESICLINECHEBYSHEV_HPP 1
+
+#include <vector>
+#include <geographic_lib/Constants.hpp>
+#include <geographic_lib/GeodesicLine.hpp>
+
+#if defined(_MSC_VER)
+// Squelch warnings about dll vs vector
+#  pragma warning (push)
+#  pragma warning (disable: 4251)
+#endif
+
+namespace geographic_lib {
+
+  /**
+   * \brief A geodesic line approximated by piecewise Chebyshev series
+   *
+   * GeodesicLineChebyshev "compiles" a segment of a GeodesicLine into a
+   * piecewise Chebyshev approximation for the latitude, the (unrolled)
+   * longitude, and the azimuth as functions of the distance \e s12 from point
+   * 1.  The segment runs from point 1 to a point 3 a distance \e s13 along
+   * the geodesic and it is split into intervals so that a position is found
+   * by a binary search for the interval followed by the summation of three
+   * short Chebyshev series.  No trigonometric functions or series in the
+   * flattening are evaluated.  This is useful when many positions are needed
+   * along the same long-lived geodesic.
+   *
+   * The intervals are found by adaptive bisection: starting with the whole
+   * segment, any interval for which the error, measured at points
+   * intermediate to the Chebyshev nodes, exceeds a tolerance \e tol supplied
+   * to the constructor is split in two.  The errors in latitude and
+   * longitude are converted to a distance on the ellipsoid, and the error in
+   * the azimuth (in radians) is multiplied by the equatorial radius and by
+   * the cosine of the latitude, so that all three errors are compared with
+   * \e tol measured in meters.  Thus only the intervals where the geodesic
+   * is hard to approximate, e.g., where it passes close to a pole and the
+   * longitude and azimuth change rapidly, are made short.  (A geodesic
+   * which passes within 1 cm of a pole needs about 40 intervals for \e tol
+   * = 1 &mu;m.)  If \e tol can't be met, because more than
+   * GeodesicLineChebyshev::MaxIntervals() intervals would be needed or
+   * because roundoff limits the accuracy (for doubles, this happens for \e
+   * tol less than a few times 10<sup>&minus;8</sup> m), the constructor
+   * throws an exception.  So MaxError() never exceeds \e tol.
+   *
+   * The cost of the construction (the number of calls to
+   * GeodesicLine::GenPosition and the processor time taken) and the memory
+   * used by the coefficients are reported by Evaluations(), BuildTime(), and
+   * MemoryUsage() so that the accuracy can be traded against the speed.
+   *
+   * The default copy constructor and assignment operators work with this
+   * class.
+   *
+   * Example of use:
+   * \include example-GeodesicLineChebyshev.cpp
+   **********************************************************************/
+
+  class GEOGRAPHICLIB_EXPORT GeodesicLineChebyshev {
+  private:
+    typedef Math::real real;
+    static const int maxintervals_ = 1 << 16;
+    real _a, _f, _lat1, _lon1, _azi1, _s0, _s1, _tol, _maxerr, _buildtime;
+    int _order, _nint;
+    unsigned long _evals;
+    // Interval i is [_bnd[i], _bnd[i + 1]]; its coefficients are at
+    // _c[3 * (_order + 1) * i]; the latitude, longitude, and azimuth series
+    // follow one another.
+    std::vector<real> _bnd, _c;
+
+    // Fit the interval [u0, u0 + ds] (tc holds the Chebyshev polynomials at
+    // the nodes); put the coefficients in c and return the max error
+    real Fit(const GeodesicLine& line, real u0, real ds,
+             const std::vector<real>& tc, real c[]);
+    // Fit the interval [u0, u0 + ds], splitting it recursively if the error
+    // exceeds _tol; perr is the error in the parent interval
+    void Refine(const GeodesicLine& line, const std::vector<real>& tc,
+                real u0, real ds, real perr);
+    void Sample(const GeodesicLine& line, real s,
+                real& lat, real& lon, real& azi);
+    // Sum the three series for one interval at x in [-1, 1]
+    static void Clenshaw(int n, real x, const real c[],
+                         real& lat, real& lon, real& azi);
+
+  public:
+
+    /**
+     * Bit masks for what calculations to do.  This is a subset of
+     * GeodesicLine::mask.
+     **********************************************************************/
+    enum mask {
+      /**
+       * No output.
+       * @hideinitializer
+       **********************************************************************/
+      NONE          = GeodesicLine::NONE,
+      /**
+       * Calculate latitude \e lat2.
+       * @hideinitializer
+       **********************************************************************/
+      LATITUDE      = GeodesicLine::LATITUDE,
+      /**
+       * Calculate longitude \e lon2.
+       * @hideinitializer
+       **********************************************************************/
+      LONGITUDE     = GeodesicLine::LONGITUDE,
+      /**
+       * Calculate azimuth \e azi2.
+       * @hideinitializer
+       **********************************************************************/
+      AZIMUTH       = GeodesicLine::AZIMUTH,
+      /**
+       * Unroll \e lon2.
+       * @hideinitializer
+       **********************************************************************/
+      LONG_UNROLL   = GeodesicLine::LONG_UNROLL,
+      /**
+       * Calculate everything.
+       * @hideinitializer
+       **********************************************************************/
+      ALL           = LATITUDE | LONGITUDE | AZIMUTH,
+    };
+
+    /** \name Constructors
+     **********************************************************************/
+    ///@{
+
+    /**
+     * Constructor for a GeodesicLineChebyshev.
+     *
+     * @param[in] line the GeodesicLine to approximate; this must have been
+     *   constructed with \e caps |= GeodesicLine::DISTANCE_IN and
+     *   GeodesicLine::LONGITUDE.
+     * @param[in] s13 the distance from point 1 to point 3 (meters); the
+     *   approximation covers distances between 0 and \e s13; it can be
+     *   negative but not zero.
+     * @param[in] tol the tolerance (meters); it must be positive.
+     * @param[in] order the order of the Chebyshev series for each interval;
+     *   it must be in [2, 64] (default 16).
+     * @exception GeographicErr if \e line lacks the required capabilities,
+     *   if \e s13, \e tol, or \e order are out of range, or if \e tol can't
+     *   be met.
+     * @exception std::bad_alloc if the memory for the coefficients can't be
+     *   allocated.
+     *
+     * The GeodesicLine is only used during the construction; it may be
+     * destroyed afterwards.
+     **********************************************************************/
+    GeodesicLineChebyshev(const GeodesicLine& line, real s13, real tol,
+                          int order = 16);
+
+    /**
+     * A default constructor.  If GeodesicLineChebyshev::Position is called on
+     * the resulting object, it returns immediately (without doing any
+     * calculations).  The object can be set with a call to
+     * GeodesicLineChebyshev::GeodesicLineChebyshev.  Use Init() to test
+     * whether object is still in this uninitialized state.
+     **********************************************************************/
+    GeodesicLineChebyshev() : _nint(0) {}
+    ///@}
+
+    /** \name Position in terms of distance
+     **********************************************************************/
+    ///@{
+
+    /**
+     * The general position function.
+     *
+     * @param[in] s12 distance from point 1 to point 2 (meters); it must lie
+     *   between 0 and \e s13.
+     * @param[in] outmask a bitor'ed combination of
+     *   GeodesicLineChebyshev::mask values specifying which of the following
+     *   parameters should be set.
+     * @param[out] lat2 latitude of point 2 (degrees).
+     * @param[out] lon2 longitude of point 2 (degrees).
+     * @param[out] azi2 (forward) azimuth at point 2 (degrees).
+     * @return true if \e s12 is in range and the object is initialized.
+     *
+     * If the function returns false, the requested outputs are set to NaNs.
+     * With \e outmask |= GeodesicLineChebyshev::LONG_UNROLL, \e lon2 is
+     * unrolled as with GeodesicLine::GenPosition; otherwise it is reduced to
+     * the range [&minus;180&deg;, 180&deg;].
+     **********************************************************************/
+    bool GenPosition(real s12, unsigned outmask,
+                     real& lat2, real& lon2, real& azi2) const;
+
+    /**
+     * Compute the position of point 2 which is a distance \e s12 (meters) from
+     * point 1.
+     *
+     * @param[in] s12 distance from point 1 to point 2 (meters).
+     * @param[out] lat2 latitude of point 2 (degrees).
+     * @param[out] lon2 longitude of point 2 (degrees).
+     * @param[out] azi2 (forward) azimuth at point 2 (degrees).
+     * @return true if \e s12 is in range and the object is initialized.
+     **********************************************************************/
+    bool Position(real s12, real& lat2, real& lon2, real& azi2) const
+    { return GenPosition(s12, ALL, lat2, lon2, azi2); }
+
+    /**
+     * See the documentation for GeodesicLineChebyshev::Position.
+     **********************************************************************/
+    bool Position(real s12, real& lat2, real& lon2) const {
+      real t;
+      return GenPosition(s12, LATITUDE | LONGITUDE, lat2, lon2, t);
+    }
+
+    /**
+     * Compute the positions of many points.
+     *
+     * @param[in] n the number of points.
+     * @param[in] s12 array of \e n distances from point 1 (meters).
+     * @param[in] outmask a bitor'ed combination of
+     *   GeodesicLineChebyshev::mask values.
+     * @param[out] lat2 array of \e n latitudes (degrees).
+     * @param[out] lon2 array of \e n longitudes (degrees).
+     * @param[out] azi2 array of \e n azimuths (degrees).
+     *
+     * Arrays corresponding to outputs not requested in \e outmask may be
+     * null.  The results are identical to calling
+     * GeodesicLineChebyshev::GenPosition \e n times.
+     **********************************************************************/
+    void GenPositions(size_t n, const real s12[], unsigned outmask,
+                      real lat2[], real lon2[], real azi2[]) const;
+    ///@}
+
+    /** \name Inspector functions
+     **********************************************************************/
+    ///@{
+
+    /**
+     * @return true if the object has been initialized.
+     **********************************************************************/
+    bool Init() const { return _nint > 0; }
+
+    /**
+     * @return \e lat1 the latitude of point 1 (degrees).
+     **********************************************************************/
+    Math::real Latitude() const
+    { return Init() ? _lat1 : Math::NaN(); }
+
+    /**
+     * @return \e lon1 the longitude of point 1 (degrees).
+     **********************************************************************/
+    Math::real Longitude() const
+    { return Init() ? _lon1 : Math::NaN(); }
+
+    /**
+     * @return \e azi1 the azimuth (degrees) of the geodesic line at point 1.
+     **********************************************************************/
+    Math::real Azimuth() const
+    { return Init() ? _azi1 : Math::NaN(); }
+
+    /**
+     * @return \e s13, the distance to point 3 (meters).
+     **********************************************************************/
+    Math::real Distance() const
+    { return Init() ? (_s0 < 0 ? _s0 : _s1) : Math::NaN(); }
+
+    /**
+     * @return \e a the equatorial radius of the ellipsoid (meters).
+     **********************************************************************/
+    Math::real MajorRadius() const
+    { return Init() ? _a : Math::NaN(); }
+
+    /**
+     * @return \e f the flattening of the ellipsoid.
+     **********************************************************************/
+    Math::real Flattening() const
+    { return Init() ? _f : Math::NaN(); }
+
+    /**
+     * @return the tolerance (meters) specified in the constructor.
+     **********************************************************************/
+    Math::real Tolerance() const
+    { return Init() ? _tol : Math::NaN(); }
+
+    /**
+     * @return the maximum error (meters) found when checking the
+     *   approximation; this does not exceed Tolerance().
+     **********************************************************************/
+    Math::real MaxError() const
+    { return Init() ? _maxerr : Math::NaN(); }
+
+    /**
+     * @return the order of the Chebyshev series.
+     **********************************************************************/
+    int Order() const { return Init() ? _order : 0; }
+
+    /**
+     * @return the number of intervals.
+     **********************************************************************/
+    int NumIntervals() const { return _nint; }
+
+    /**
+     * @return the number of calls to GeodesicLine::GenPosition made by the
+     *   constructor.
+     **********************************************************************/
+    unsigned long Evaluations() const { return Init() ? _evals : 0UL; }
+
+    /**
+     * @return the processor time used by the constructor (seconds).
+     **********************************************************************/
+    Math::real BuildTime() const
+    { return Init() ? _buildtime : Math::NaN(); }
+
+    /**
+     * @return the memory used by the object including the coefficients
+     *   (bytes).
+     **********************************************************************/
+    size_t MemoryUsage() const
+    { return sizeof(GeodesicLineChebyshev) + _c.capacity() * sizeof(real); }
+
+    /**
+     * @return the largest number of intervals which will be used.
+     **********************************************************************/
+    static int MaxIntervals() { return maxintervals_; }
+    ///@}
+
+  };
+
+} // namespace geographic_lib
+
+#if defined(_MSC_VER)
+#  pragma warning (pop)
+#endif
+
+#endif  // GEOGRAPHICLIB_GEODESICLINECHEBYSHEV_HPP
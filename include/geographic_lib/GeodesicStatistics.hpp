@@ -0,0 +1,127 @@
+/**
+ * \file GeodesicStatistics.hpp
+ * \brief Header for geographic_lib::GeodesicStatistics class
+ *
+ * Copyright (c) 2026 the geographic_lib authors and licensed under the
+ * MIT/X11 License.  This file is not part of the upstream GeographicLib
+ * distribution; see https://geographiclib.sourceforge.io/ for that.
+ **********************************************************************/
+
+#if !defined(GEOGRAPHICLIB_GEODESICSTATISTICS_HPP)
+#define GEOGRAPHICLIB_GEODESICSTATISTICS_HPP 1
+
+#include <geographic_lib/Constants.hpp>
+
+#if !defined(GEOGRAPHICLIB_GEODESIC_STATISTICS)
+/**
+ * Should Geodesic and GeodesicExact accumulate GeodesicStatistics?  This is
+ * normally set in Config.h (configure cmake with -D GEODESIC_STATISTICS=ON).
+ * The default, 0, means that no statistics are kept and the solution of the
+ * inverse problem bears no extra cost.
+ **********************************************************************/
+#  define GEOGRAPHICLIB_GEODESIC_STATISTICS 0
+#endif
+
+namespace geographic_lib {
+
+  /**
+   * \brief Statistics on the solution of the inverse geodesic problem
+   *
+   * This holds counts of the events in the solution of the inverse geodesic
+   * problem which determine its cost: the number of iterations of Newton's
+   * method, the fallbacks to bisection, and the calls to the astroid solver
+   * which provides the starting guess for nearly antipodal points.  The
+   * counts are only accumulated if the library is compiled with
+   * GEOGRAPHICLIB_GEODESIC_STATISTICS = 1.  They are kept separately for
+   * each thread (if C++11 threads are available) and for each class
+   * (Geodesic, GeodesicF, and GeodesicExact); see Geodesic::Statistics and
+   * Geodesic::ResetStatistics.  Unlike the other classes in %geographic_lib,
+   * this is a plain aggregate of counters with public members.
+   **********************************************************************/
+  class GeodesicStatistics {
+  public:
+    /**
+     * The number of bins in GeodesicStatistics::histogram.
+     **********************************************************************/
+    static const int nhist = 32;
+    /**
+     * The number of calls to GenInverse.
+     **********************************************************************/
+    unsigned long inverse;
+    /**
+     * The number of calls to GenInverse which needed the iterative solution
+     * (i.e., excluding short, meridional, and equatorial geodesics).
+     **********************************************************************/
+    unsigned long iterative;
+    /**
+     * The total number of evaluations of &lambda;<sub>12</sub> by the
+     * iterative solutions.
+     **********************************************************************/
+    unsigned long iterations;
+    /**
+     * The maximum number of evaluations of &lambda;<sub>12</sub> in any
+     * iterative solution.
+     **********************************************************************/
+    unsigned long maxiterations;
+    /**
+     * The number of iterative solutions which took at least one bisection
+     * step (because Newton's method went out of range).
+     **********************************************************************/
+    unsigned long bisection;
+    /**
+     * The number of iterative solutions which did not converge in the
+     * maxit1_ iterations allowed for Newton's method and so fell back to
+     * bisection.
+     **********************************************************************/
+    unsigned long maxit1;
+    /**
+     * The number of iterative solutions which did not converge at all (the
+     * result is then less accurate than usual).
+     **********************************************************************/
+    unsigned long failures;
+    /**
+     * The number of calls to the astroid solver; this is needed for nearly
+     * antipodal points.
+     **********************************************************************/
+    unsigned long astroid;
+    /**
+     * histogram[\e k] is the number of iterative solutions which needed
+     * \e k evaluations of &lambda;<sub>12</sub>; the last bin includes all
+     * those needing nhist &minus; 1 or more evaluations.
+     **********************************************************************/
+    unsigned long histogram[nhist];
+
+    /**
+     * Constructor setting all the counts to zero.
+     **********************************************************************/
+    GeodesicStatistics() { Reset(); }
+
+    /**
+     * Set all the counts to zero.
+     **********************************************************************/
+    void Reset() {
+      inverse = iterative = iterations = maxiterations = bisection =
+        maxit1 = failures = astroid = 0;
+      std::fill(histogram, histogram + nhist, 0UL);
+    }
+
+    /// \cond SKIP
+    // Record an iterative solution which exited the loop with index numit.
+    void AddIterative(unsigned numit, unsigned maxit1x, unsigned maxit2x,
+                      bool bisected) {
+      // If the loop converged, numit is the index of the last evaluation
+      unsigned long n = numit < maxit2x ? numit + 1 : maxit2x;
+      ++iterative;
+      iterations += n;
+      if (n > maxiterations) maxiterations = n;
+      ++histogram[n < unsigned(nhist) ? n : nhist - 1];
+      if (bisected) ++bisection;
+      if (n > maxit1x) ++maxit1;
+      if (numit >= maxit2x) ++failures;
+    }
+    /// \endcond
+  };
+
+} // namespace geographic_lib
+
+#endif  // GEOGRAPHICLIB_GEODESICSTATISTICS_HPP
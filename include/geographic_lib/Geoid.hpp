@@ -12,6 +12,7 @@
 
 #include <vector>
 #include <fstream>
+#include <cstring>
 #include <geographic_lib/Constants.hpp>
 
 #if defined(_MSC_VER)
@@ -31,8 +32,106 @@
 #  define GEOGRAPHICLIB_GEOID_PGM_PIXEL_WIDTH 2
 #endif
 
+#if !defined(GEOGRAPHICLIB_GEOID_STATISTICS)
+/**
+ * Should Geoid accumulate GeoidStatistics?  This is normally set in Config.h
+ * (configure cmake with -D GEOID_STATISTICS=ON).  The default, 0, means that
+ * no statistics are kept and the lookup of the grid values bears no extra
+ * cost.
+ **********************************************************************/
+#  define GEOGRAPHICLIB_GEOID_STATISTICS 0
+#endif
+
 namespace geographic_lib {
 
+  /**
+   * \brief Statistics on the access to the geoid data
+   *
+   * This holds counts of where the grid values used by Geoid came from (the
+   * area cache, the memory-mapped file, the tile cache, or the data file),
+   * of the reads from the data file and the time they took, and of the reuse
+   * of the interpolation coefficients in a Geoid::CellCache.  These allow
+   * the area given to Geoid::CacheArea to be sized and I/O-bound threads to
+   * be detected.  The counts are only accumulated if the library is
+   * compiled with GEOGRAPHICLIB_GEOID_STATISTICS = 1.  They are kept
+   * separately for each thread (if C++11 threads are available) and include
+   * the activity of all Geoid objects; see Geoid::Statistics and
+   * Geoid::ResetStatistics.  Like GeodesicStatistics, this is a plain
+   * aggregate of counters with public members.
+   **********************************************************************/
+  class GeoidStatistics {
+  public:
+    /**
+     * The number of grid values read from the area cache (set by
+     * Geoid::CacheArea or by constructing a thread safe Geoid).
+     **********************************************************************/
+    unsigned long long cachereads;
+    /**
+     * The number of grid values read from the memory-mapped data file.
+     **********************************************************************/
+    unsigned long long mapreads;
+    /**
+     * The number of grid values read via the tile cache (see
+     * Geoid::CacheTiles).
+     **********************************************************************/
+    unsigned long long tilereads;
+    /**
+     * The number of grid values read individually from the data file (there
+     * being no cache covering them).
+     **********************************************************************/
+    unsigned long long filereads;
+    /**
+     * The number of read operations on the data file: reads of single
+     * values, of tiles for the tile cache, and of the rows for the area
+     * cache.  Tiles read by the background prefetch thread are not included
+     * (see Geoid::TilePrefetches).
+     **********************************************************************/
+    unsigned long long reads;
+    /**
+     * The number of bytes read from the data file by these operations.
+     **********************************************************************/
+    unsigned long long bytes;
+    /**
+     * The time spent in these operations (seconds).  This is wall-clock
+     * time if C++11 is available and processor time otherwise.
+     **********************************************************************/
+    double iotime;
+    /**
+     * The number of times the interpolation coefficients for a cell were
+     * found in a Geoid::CellCache.
+     **********************************************************************/
+    unsigned long long cellhits;
+    /**
+     * The number of times the interpolation coefficients for a cell had to
+     * be computed.  (Geoid::Row computes its coefficients incrementally
+     * and is not included in this or in cellhits.)
+     **********************************************************************/
+    unsigned long long cellmisses;
+
+    /**
+     * Constructor setting all the counts to zero.
+     **********************************************************************/
+    GeoidStatistics() { Reset(); }
+
+    /**
+     * Set all the counts to zero.
+     **********************************************************************/
+    void Reset() {
+      cachereads = mapreads = tilereads = filereads = reads = bytes =
+        cellhits = cellmisses = 0;
+      iotime = 0;
+    }
+
+    /// \cond SKIP
+    // Record a read of n bytes from the data file taking t seconds
+    void AddRead(unsigned long long n, double t) {
+      ++reads;
+      bytes += n;
+      iotime += t;
+    }
+    /// \endcond
+  };
+
   /**
    * \brief Looking up the height of the geoid above the ellipsoid
    *
@@ -72,6 +171,20 @@ namespace geographic_lib {
    * single-cell caching which results in a Geoid object which \e is thread
    * safe.
    *
+   * Alternatively, set the optional \e memorymap parameter to true in the
+   * constructor.  The data file is then mapped into memory and the grid
+   * values are read directly from the mapped region.  Construction is fast
+   * regardless of the size of the data set (the data is paged in by the
+   * operating system as needed) and the pages are shared by all the objects
+   * and processes using the same data file.  If both \e threadsafe and \e
+   * memorymap are true, the resulting object is thread safe without the
+   * need to read all the data into memory.
+   *
+   * A thread safe Geoid does not use its own single-cell cache.  Instead,
+   * each thread can pass its own Geoid::CellCache to Geoid::operator()(real,
+   * real, CellCache&) const so that the threads share a single copy of the
+   * data and each benefits from caching.
+   *
    * Example of use:
    * \include example-Geoid.cpp
    *
@@ -99,26 +212,73 @@ namespace geographic_lib {
     static const int c3_[stencilsize_ * nterms_];
     static const int c3n_[stencilsize_ * nterms_];
     static const int c3s_[stencilsize_ * nterms_];
+    // The first line and the extension of a native geoid file
+    static const char* const nativeid_;
+    static const char* const nativeext_;
+    // The extension of a PGM geoid file
+    static const char* const pgmext_;
+
+  public:
+    /**
+     * \brief The single-cell cache for a Geoid
+     *
+     * This holds the interpolation coefficients for the most recently used
+     * grid cell.  Geoid holds one of these for use by Geoid::operator()(real,
+     * real) const.  A calling program can supply its own to
+     * Geoid::operator()(real, real, CellCache&) const; with a thread safe
+     * Geoid, each thread can then keep its own CellCache (e.g., in a
+     * thread_local variable) and the threads can evaluate heights
+     * concurrently while still benefiting from the caching.  A CellCache
+     * remembers which Geoid it was last used with (by a serial number unique
+     * to each Geoid constructed by the program, so a new Geoid at the address
+     * of a destroyed one is recognized as different) and is reset
+     * automatically if it's used with another one.
+     **********************************************************************/
+    class CellCache {
+    private:
+      friend class Geoid;
+      // The serial number of the Geoid last used with (0 for none)
+      unsigned long long _serial;
+      int _ix, _iy;
+      real _v00, _v01, _v10, _v11;
+      real _t[nterms_];
+    public:
+      /**
+       * Constructor for an empty CellCache.
+       **********************************************************************/
+      CellCache() : _serial(0), _ix(-1), _iy(-1) {}
+    };
 
+  private:
     std::string _name, _dir, _filename;
     const bool _cubic;
     const real _a, _e2, _degree, _eps;
     mutable std::ifstream _file;
+    // The memory mapped data file (null if the file isn't mapped)
+    const unsigned char* _map;
+    unsigned long long _mapsize;
     real _rlonres, _rlatres;
     std::string _description, _datetime;
     real _offset, _scale, _maxerror, _rmserror;
     int _width, _height;
     unsigned long long _datastart, _swidth;
+    // The byte order of the data (big-endian for a PGM file)
+    bool _bigend;
     bool _threadsafe;
-    // Area cache
-    mutable std::vector< std::vector<pixel_t> > _data;
+    // The serial number of this Geoid, used to key CellCaches
+    const unsigned long long _serial;
+    // Area cache; row iy - _yoffset starts at element (iy - _yoffset) *
+    // _xsize
+    mutable std::vector<pixel_t> _data;
     mutable bool _cache;
     // NE corner and extent of cache
     mutable int _xoffset, _yoffset, _xsize, _ysize;
     // Cell cache
-    mutable int _ix, _iy;
-    mutable real _v00, _v01, _v10, _v11;
-    mutable real _t[nterms_];
+    mutable CellCache _cell;
+    // Tile cache (null unless CacheTiles has been called); the class is
+    // defined in Geoid.cpp.
+    class TileStore;
+    mutable TileStore* _tiles;
     void filepos(int ix, int iy) const {
       _file.seekg(
 #if !(defined(__GNUC__) && __GNUC__ < 4)
@@ -128,6 +288,44 @@ namespace geographic_lib {
                   (_datastart +
                    pixel_size_ * (unsigned(iy)*_swidth + unsigned(ix))));
     }
+    // Assemble a pixel value from the pixel_size_ bytes at p
+    unsigned pixelval(const unsigned char* p) const {
+      if (_bigend == Math::bigendian) {
+        pixel_t r;
+        std::memcpy(&r, p, pixel_size_);
+        return r;
+      }
+      unsigned r = 0;
+      if (_bigend)
+        for (unsigned i = 0; i < pixel_size_; ++i)
+          r = (r << 8) | unsigned(p[i]);
+      else
+        for (unsigned i = pixel_size_; i--;)
+          r = (r << 8) | unsigned(p[i]);
+      return r;
+    }
+    unsigned mappedval(int ix, int iy) const {
+      return pixelval(_map + _datastart +
+                      pixel_size_ * (unsigned(iy)*_swidth + unsigned(ix)));
+    }
+    // Read num pixels from the current position of _file
+    void readpixels(pixel_t array[], size_t num) const;
+    // Read pixel (ix, iy) from _file
+    unsigned fileval(int ix, int iy) const;
+#if GEOGRAPHICLIB_GEOID_STATISTICS
+    // The statistics for this thread
+    static GeoidStatistics& Stats();
+#endif
+    // The time (seconds) for measuring the I/O time
+    static double wallclock();
+    // A new serial number for a Geoid
+    static unsigned long long nextserial();
+    // Read and check the header of _file
+    void readheader();
+    void mapfile();
+    void unmapfile();
+    // Return the value of pixel (ix, iy) from the tile cache
+    unsigned tileval(int ix, int iy) const;
     real rawval(int ix, int iy) const {
       if (ix < 0)
         ix += _width;
@@ -136,41 +334,71 @@ namespace geographic_lib {
       if (_cache && iy >= _yoffset && iy < _yoffset + _ysize &&
           ((ix >= _xoffset && ix < _xoffset + _xsize) ||
            (ix + _width >= _xoffset && ix + _width < _xoffset + _xsize))) {
-        return real(_data[iy - _yoffset]
-                    [ix >= _xoffset ? ix - _xoffset : ix + _width - _xoffset]);
+#if GEOGRAPHICLIB_GEOID_STATISTICS
+        ++Stats().cachereads;
+#endif
+        return real(_data[size_t(iy - _yoffset) * size_t(_xsize) +
+                          (ix >= _xoffset ? ix - _xoffset :
+                           ix + _width - _xoffset)]);
       } else {
         if (iy < 0 || iy >= _height) {
           iy = iy < 0 ? -iy : 2 * (_height - 1) - iy;
           ix += (ix < _width/2 ? 1 : -1) * _width/2;
         }
-        try {
-          filepos(ix, iy);
-          // initial values to suppress warnings in case get fails
-          char a = 0, b = 0;
-          _file.get(a);
-          _file.get(b);
-          unsigned r = ((unsigned char)(a) << 8) | (unsigned char)(b);
-          if (pixel_size_ == 4) {
-            _file.get(a);
-            _file.get(b);
-            r = (r << 16) | ((unsigned char)(a) << 8) | (unsigned char)(b);
-          }
-          return real(r);
+        if (_map) {
+#if GEOGRAPHICLIB_GEOID_STATISTICS
+          ++Stats().mapreads;
+#endif
+          return real(mappedval(ix, iy));
         }
-        catch (const std::exception& e) {
-          // throw GeographicErr("Error reading " + _filename + ": "
-          //                      + e.what());
-          // triggers complaints about the "binary '+'" under Visual Studio.
-          // So use '+=' instead.
-          std::string err("Error reading ");
-          err += _filename;
-          err += ": ";
-          err += e.what();
-          throw GeographicErr(err);
+        if (_tiles) {
+#if GEOGRAPHICLIB_GEOID_STATISTICS
+          ++Stats().tilereads;
+#endif
+          return real(tileval(ix, iy));
         }
+        return real(fileval(ix, iy));
       }
     }
-    real height(real lat, real lon) const;
+    // Find the cell (ix, iy) containing (lat, lon) and the position (fx, fy)
+    // within it; return false if lat or lon is a NaN.
+    bool cellpos(real lat, real lon,
+                 int& ix, int& iy, real& fx, real& fy) const;
+    // Read the values of the interpolation stencil for cell (ix, iy) into v;
+    // the bilinear stencil is (ix, iy), (ix + 1, iy), (ix, iy + 1), (ix + 1,
+    // iy + 1); the cubic stencil is given by xarr and yarr in the comments in
+    // Geoid.cpp.
+    void cellstencil(int ix, int iy, real v[]) const;
+    // Set the coefficients in cell for (ix, iy) unless they are there already
+    void cellcoeffs(int ix, int iy, CellCache& cell) const;
+    // Compute the height using the coefficients in cell if possible; cell
+    // may be null in which case the coefficients are always computed.
+    real height(real lat, real lon, CellCache* cell) const;
+    // The number of points processed together by Heights
+    static const unsigned batch_ = 1024;
+    // Scratch space for Heights, allocated once per call for batches of at
+    // most m <= batch_ points.  The per-point arrays are indexed by the
+    // position in the batch; the hash table has hmask + 1 >= 2 * m slots
+    // (a power of 2).  hbuf holds the results for ConvertHeight.
+    struct Workspace {
+      unsigned hmask;
+      std::vector<real> fx, fy, gx, gy, gh, hbuf;
+      std::vector<unsigned> bucket, order, count, hbucket;
+      std::vector<unsigned long long> bcell, hcell;
+      explicit Workspace(unsigned m)
+        : hmask(hashmask(m))
+        , fx(m), fy(m), gx(m), gy(m), gh(m), hbuf(m)
+        , bucket(m), order(m), count(m), hbucket(hmask + 1)
+        , bcell(m), hcell(hmask + 1) {}
+      static unsigned hashmask(unsigned m) {
+        unsigned k = 1;
+        while (k < 2 * m) k *= 2;
+        return k - 1;
+      }
+    };
+    // Compute the heights for n <= batch_ points
+    void heights(size_t n, const real lat[], const real lon[], real h[],
+                 CellCache& cell, Workspace& w) const;
     Geoid(const Geoid&);            // copy constructor not allowed
     Geoid& operator=(const Geoid&); // copy assignment not allowed
   public:
@@ -208,20 +436,41 @@ namespace geographic_lib {
      *   true (the default) means cubic.
      * @param[in] threadsafe (optional), if true, construct a thread safe
      *   object.  The default is false
+     * @param[in] memorymap (optional), if true, map the data file into
+     *   memory.  The default is false.
      * @exception GeographicErr if the data file cannot be found, is
      *   unreadable, or is corrupt.
-     * @exception GeographicErr if \e threadsafe is true but the memory
-     *   necessary for caching the data can't be allocated.
+     * @exception GeographicErr if \e threadsafe is true (and \e memorymap is
+     *   false) but the memory necessary for caching the data can't be
+     *   allocated.
+     * @exception GeographicErr if \e memorymap is true but the data file
+     *   can't be mapped.
      *
-     * The data file is formed by appending ".pgm" to the name.  If \e path is
-     * specified (and is non-empty), then the file is loaded from directory, \e
-     * path.  Otherwise the path is given by DefaultGeoidPath().  If the \e
+     * The data file is formed by appending ".pgm" to the name.  However, if
+     * a file formed by appending ".geoid" to the name exists (and its header
+     * can be read), this is used instead; this holds the data in the native
+     * format (see WriteNative).  Note that a ".geoid" file is used even if it
+     * is older than the ".pgm" file; so if the ".pgm" file is updated, the
+     * ".geoid" file must be regenerated (or removed).
+     * If \e path is specified (and is non-empty), then the file is loaded
+     * from directory, \e path.  Otherwise the path is given by
+     * DefaultGeoidPath().  If the \e
      * threadsafe parameter is true, the data set is read into memory, the data
      * file is closed, and single-cell caching is turned off; this results in a
-     * Geoid object which \e is thread safe.
+     * Geoid object which \e is thread safe.  If the \e memorymap parameter
+     * is true, the data file is mapped into memory and closed, and the data
+     * is read from the mapped region; in this case the \e threadsafe
+     * parameter just turns off the single-cell caching.
      **********************************************************************/
     explicit Geoid(const std::string& name, const std::string& path = "",
-                   bool cubic = true, bool threadsafe = false);
+                   bool cubic = true, bool threadsafe = false,
+                   bool memorymap = false);
+
+    /**
+     * Destructor.  This unmaps the data file and stops the tile prefetch
+     * thread if necessary.
+     **********************************************************************/
+    ~Geoid();
 
     /**
      * Set up a cache.
@@ -242,7 +491,9 @@ namespace geographic_lib {
      * parallels \e south and \e north and the meridians \e west and \e east.
      * \e east is always interpreted as being east of \e west, if necessary by
      * adding 360&deg; to its value.  \e south and \e north should be in
-     * the range [&minus;90&deg;, 90&deg;].
+     * the range [&minus;90&deg;, 90&deg;].  This does nothing if the data file
+     * is memory mapped, since all the data is then already accessible in
+     * memory.
      **********************************************************************/
     void CacheArea(real south, real west, real north, real east) const;
 
@@ -263,11 +514,75 @@ namespace geographic_lib {
                                       real(90), real(360)); }
 
     /**
-     * Clear the cache.  This never throws an error.  (This does nothing with a
-     * thread safe Geoid.)
+     * Set up a tile cache.
+     *
+     * @param[in] budget the maximum memory (in bytes) to use for the cached
+     *   data.
+     * @param[in] tilesize (optional) the size of a side of a tile in
+     *   pixels.  The default is 64.
+     * @param[in] prefetch (optional) if true (the default), read the tiles
+     *   neighboring those in use in the background.
+     * @exception GeographicErr if \e tilesize is not positive or if \e
+     *   budget is less than the size of a tile.
+     * @exception GeographicErr if this is called on a threadsafe Geoid.
+     *
+     * The data is divided into square tiles of \e tilesize &times; \e
+     * tilesize pixels.  A tile is read from the data file when a value in it
+     * is first needed and it is held in the cache until it is evicted (least
+     * recently used first) to keep the memory below \e budget.  Unlike
+     * CacheArea, which caches a single rectangle, this efficiently supports
+     * points scattered over several separate regions.  This replaces any
+     * cache set up with CacheArea (and CacheArea replaces the tile cache).
+     * This does nothing if the data file is memory mapped.
+     *
+     * With \e prefetch, when a tile is read from the file (or a prefetched
+     * tile is first used), its 8 neighbors are queued to be read by a
+     * background thread which uses its own handle to the data file.  Up to 8
+     * prefetched tiles which have not yet been used count against \e budget;
+     * prefetching is turned off if \e budget allows fewer than 16 tiles.
+     * Prefetched tiles enter the cache as the least recently used tiles, so
+     * unused ones are evicted before any tile which has been used.
+     * Prefetching requires C++11 threads (GEOGRAPHICLIB_CXX11_THREADS);
+     * otherwise \e prefetch is ignored.
+     *
+     * The cache's effectiveness is reported by TileHits, TileMisses, and
+     * TilePrefetches.  These counters are reset by this function and by
+     * CacheClear.
+     **********************************************************************/
+    void CacheTiles(size_t budget, int tilesize = 64,
+                    bool prefetch = true) const;
+
+    /**
+     * Clear the cache (including the tile cache).  This never throws an
+     * error.  (This does nothing with a thread safe Geoid.)
      **********************************************************************/
     void CacheClear() const;
 
+    /**
+     * Write the data in the native format.
+     *
+     * @param[in] filename the name of the file to write.
+     * @exception GeographicErr if the PGM data file can't be read or if \e
+     *   filename can't be written.
+     *
+     * The native format is the same as the PGM format except that the first
+     * line of the header is "GEOID-LE", the header is padded so that the
+     * data is aligned, and the pixel data is little-endian.  On
+     * little-endian machines, this means that the data can be cached, or
+     * read from a memory mapped file, without swapping the bytes.  The
+     * comment lines from the header of the original file are preserved.
+     * To use the native file, name it with the extension ".geoid" (in place
+     * of ".pgm") and place it alongside the PGM file.
+     *
+     * The data is always taken from the PGM file, even if this Geoid was
+     * read from a native file; so this can be used to regenerate a stale
+     * native file.  The output is written to \e filename + ".tmp" which is
+     * then renamed to \e filename; thus \e filename is left unchanged if
+     * there's an error (and it may be the native file that this Geoid is
+     * reading).
+     **********************************************************************/
+    void WriteNative(const std::string& filename) const;
+
     ///@}
 
     /** \name Compute geoid heights
@@ -286,7 +601,29 @@ namespace geographic_lib {
      * The latitude should be in [&minus;90&deg;, 90&deg;].
      **********************************************************************/
     Math::real operator()(real lat, real lon) const {
-      return height(lat, lon);
+      return height(lat, lon, _threadsafe ? 0 : &_cell);
+    }
+
+    /**
+     * Compute the geoid height at a point using a caller-supplied cell
+     * cache.
+     *
+     * @param[in] lat latitude of the point (degrees).
+     * @param[in] lon longitude of the point (degrees).
+     * @param[in,out] cell the CellCache to use.
+     * @exception GeographicErr if there's a problem reading the data; this
+     *   never happens if (\e lat, \e lon) is within a successfully cached
+     *   area.
+     * @return the height of the geoid above the ellipsoid (meters).
+     *
+     * This returns the same result as Geoid::operator()(real, real) const,
+     * but the single-cell cache is held in \e cell instead of in the Geoid
+     * object.  If the Geoid is thread safe, it is safe for several threads
+     * to call this function concurrently, provided that each uses a
+     * different CellCache.
+     **********************************************************************/
+    Math::real operator()(real lat, real lon, CellCache& cell) const {
+      return height(lat, lon, &cell);
     }
 
     /**
@@ -307,9 +644,108 @@ namespace geographic_lib {
      **********************************************************************/
     Math::real ConvertHeight(real lat, real lon, real h,
                              convertflag d) const {
-      return h + real(d) * height(lat, lon);
+      return h + real(d) * (*this)(lat, lon);
+    }
+
+    /**
+     * Convert a height above the geoid to a height above the ellipsoid and
+     * vice versa using a caller-supplied cell cache.
+     *
+     * @param[in] lat latitude of the point (degrees).
+     * @param[in] lon longitude of the point (degrees).
+     * @param[in] h height of the point (degrees).
+     * @param[in] d a Geoid::convertflag specifying the direction of the
+     *   conversion.
+     * @param[in,out] cell the CellCache to use.
+     * @exception GeographicErr if there's a problem reading the data; this
+     *   never happens if (\e lat, \e lon) is within a successfully cached
+     *   area.
+     * @return converted height (meters).
+     *
+     * See Geoid::operator()(real, real, CellCache&) const.
+     **********************************************************************/
+    Math::real ConvertHeight(real lat, real lon, real h,
+                             convertflag d, CellCache& cell) const {
+      return h + real(d) * height(lat, lon, &cell);
     }
 
+    /**
+     * Compute the geoid heights at many points.
+     *
+     * @param[in] n the number of points.
+     * @param[in] lat array of \e n latitudes (degrees).
+     * @param[in] lon array of \e n longitudes (degrees).
+     * @param[out] h array of \e n heights of the geoid above the ellipsoid
+     *   (meters).
+     * @exception GeographicErr if there's a problem reading the data; this
+     *   never happens if all the points are within a successfully cached
+     *   area.
+     *
+     * The results are the same as calling Geoid::operator()(real, real)
+     * const for each point.  However the points are processed in batches;
+     * within a batch, the points are grouped by grid cell, the interpolation
+     * coefficients are computed once per cell, and the interpolant is
+     * evaluated for all the points in a cell in a loop which the compiler
+     * can vectorize.  This is much faster than evaluating the points one at
+     * a time when many points share grid cells (e.g., for the points in a
+     * LiDAR tile).  The single-cell cache of the Geoid is not used, so this
+     * may be called concurrently by several threads on a thread safe Geoid.
+     * The scratch space is allocated once per call and its size is
+     * proportional to min(\e n, 1024).
+     **********************************************************************/
+    void Heights(size_t n, const real lat[], const real lon[],
+                 real h[]) const;
+
+    /**
+     * Convert heights above the geoid to heights above the ellipsoid and
+     * vice versa for many points.
+     *
+     * @param[in] n the number of points.
+     * @param[in] lat array of \e n latitudes (degrees).
+     * @param[in] lon array of \e n longitudes (degrees).
+     * @param[in] h array of \e n heights (meters).
+     * @param[in] d a Geoid::convertflag specifying the direction of the
+     *   conversion.
+     * @param[out] hout array of \e n converted heights (meters); this may
+     *   be the same array as \e h.
+     * @exception GeographicErr if there's a problem reading the data; this
+     *   never happens if all the points are within a successfully cached
+     *   area.
+     *
+     * See Geoid::Heights for details.
+     **********************************************************************/
+    void ConvertHeight(size_t n, const real lat[], const real lon[],
+                       const real h[], convertflag d, real hout[]) const;
+
+    /**
+     * Compute the geoid heights along a line of constant latitude.
+     *
+     * @param[in] lat latitude of the points (degrees).
+     * @param[in] lon0 longitude of the first point (degrees).
+     * @param[in] dlon longitude spacing of the points (degrees); this may be
+     *   negative.
+     * @param[in] n the number of points.
+     * @param[out] h array of \e n heights of the geoid above the ellipsoid
+     *   (meters); element \e j is the height at longitude \e lon0 + \e j \e
+     *   dlon.
+     * @exception GeographicErr if there's a problem reading the data; this
+     *   never happens if all the points are within a successfully cached
+     *   area.
+     *
+     * This is intended for sampling the geoid along the scanlines of a
+     * raster.  The latitude is reduced and its interpolation weights are
+     * computed once; the points then step through the grid cells in order
+     * and, on moving to an adjacent cell, only the new column of the
+     * interpolation stencil is read.  The results agree with those of
+     * Geoid::operator()(real, real) const to within roundoff.  (However,
+     * the cubic interpolant is discontinuous at the cell boundaries; a point
+     * within roundoff of a boundary may be assigned to the neighboring cell
+     * and its height then differs by the size of the discontinuity.)  The
+     * single-cell cache of the Geoid is not used, so this may be called
+     * concurrently by several threads on a thread safe Geoid.
+     **********************************************************************/
+    void Row(real lat, real lon0, real dlon, size_t n, real h[]) const;
+
     ///@}
 
     /** \name Inspector functions
@@ -387,11 +823,55 @@ namespace geographic_lib {
      **********************************************************************/
     bool ThreadSafe() const { return _threadsafe; }
 
+    /**
+     * @return true if the data file is mapped into memory.
+     **********************************************************************/
+    bool MemoryMapped() const { return _map != 0; }
+
     /**
      * @return true if a data cache is active.
      **********************************************************************/
     bool Cache() const { return _cache; }
 
+    /**
+     * @return true if a tile cache is active (see CacheTiles).
+     **********************************************************************/
+    bool TileCache() const { return _tiles != 0; }
+
+    /**
+     * @return the size of a side of a tile (pixels) or 0 if the tile cache
+     *   is not active.
+     **********************************************************************/
+    int TileSize() const;
+
+    /**
+     * @return the memory budget for the tile cache (bytes) or 0 if the tile
+     *   cache is not active.
+     **********************************************************************/
+    size_t TileBudget() const;
+
+    /**
+     * @return the number of tiles currently held in the tile cache.
+     **********************************************************************/
+    size_t TileCount() const;
+
+    /**
+     * @return the number of pixel reads satisfied by the tile cache
+     *   (including those from prefetched tiles).
+     **********************************************************************/
+    unsigned long long TileHits() const;
+
+    /**
+     * @return the number of pixel reads which required a tile to be read
+     *   from the data file.
+     **********************************************************************/
+    unsigned long long TileMisses() const;
+
+    /**
+     * @return the number of tiles read by the background prefetch thread.
+     **********************************************************************/
+    unsigned long long TilePrefetches() const;
+
     /**
      * @return west edge of the cached area; the cache includes this edge.
      **********************************************************************/
@@ -444,6 +924,25 @@ namespace geographic_lib {
     Math::real Flattening() const { return Constants::WGS84_f(); }
     ///@}
 
+    /** \name Statistics on the access to the data
+     **********************************************************************/
+    ///@{
+    /**
+     * @return a snapshot of the GeoidStatistics accumulated by all the Geoid
+     *   objects in the calling thread since the thread started or since the
+     *   last call to Geoid::ResetStatistics.
+     *
+     * All the counts are zero unless the library was compiled with
+     * GEOGRAPHICLIB_GEOID_STATISTICS = 1.
+     **********************************************************************/
+    static GeoidStatistics Statistics();
+
+    /**
+     * Reset the GeoidStatistics for the calling thread.
+     **********************************************************************/
+    static void ResetStatistics();
+    ///@}
+
     /**
      * @return the default path for geoid data files.
      *
@@ -153,6 +153,24 @@ namespace geographic_lib {
      **********************************************************************/
     Math::real GeoidHeight(real lon) const;
 
+    /**
+     * Evaluate the geoid height for equally spaced longitudes.
+     *
+     * @param[in] lon0 the first longitude (degrees).
+     * @param[in] dlon the spacing of the longitudes (degrees).
+     * @param[in] n the number of longitudes.
+     * @param[out] N an array of \e n geoid heights (meters); \e N[\e j] is
+     *   the geoid height at longitude \e lon0 + \e j \e dlon.
+     * @exception std::bad_alloc if the temporary memory (proportional to \e
+     *   n) can't be allocated.
+     *
+     * This gives the same results as \e n calls to GeoidHeight(real lon)
+     * const; however, it uses CircularEngine::Values to evaluate the sums
+     * for several longitudes together, which is substantially faster.  This
+     * is used by GravityGrid to generate grids of geoid heights.
+     **********************************************************************/
+    void GeoidHeight(real lon0, real dlon, size_t n, real N[]) const;
+
     /**
      * Evaluate the components of the gravity anomaly vector using the
      * spherical approximation.
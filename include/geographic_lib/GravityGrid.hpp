@@ -0,0 +1,256 @@
+/**
+ * \file GravityGrid.hpp
+ * \brief Header for geographic_lib::GravityGrid class
+ *
+ * Copyright (c) 2026 the geographic_lib authors and licensed under the
+ * MIT/X11 License.  This file is not part of the upstream GeographicLib
+ * distribution; see https://geographiclib.sourceforge.io/ for that.
+ **********************************************************************/
+
+#if !defined(GEOGRAPHICLIB_GRAVITYGRID_HPP)
+#define GEOGRAPHICLIB_GRAVITYGRID_HPP 1
+
+#include <iosfwd>
+#include <string>
+#include <geographic_lib/Constants.hpp>
+
+namespace geographic_lib {
+
+  class GravityModel;
+
+  /**
+   * \brief Generate grids of geoid heights and gravity anomalies
+   *
+   * This evaluates a quantity (the geoid height, the gravity disturbance, or
+   * the gravity anomaly) given by a GravityModel on a regular grid of
+   * latitudes and longitudes.  The grid is specified by its south-west
+   * corner, the spacings in latitude and longitude, and the numbers of rows
+   * and columns; it may cover the whole earth or any region.  Each row of
+   * the grid is computed with a single GravityCircle.
+   *
+   * The rows are computed in batches.  If the library is compiled with
+   * OpenMP enabled (e.g., by configuring with cmake -D USE_OPENMP=ON), the
+   * rows in a batch are handed out dynamically to the threads of an OpenMP
+   * team.  The number of threads is then controlled in the usual way, e.g.,
+   * with the OMP_NUM_THREADS environment variable.  Otherwise the rows are
+   * computed sequentially.
+   *
+   * The WritePGM and WriteGTX functions stream the grid to a file one batch
+   * at a time, so that the memory needed is independent of the size of the
+   * grid, optionally reporting the progress and the throughput.  WritePGM
+   * writes the format read by Geoid (either the PGM format or its native
+   * little-endian variant); WriteGTX writes the format used by NOAA's
+   * VDatum.  Alternatively, Rows returns the values for a set of rows.
+   *
+   * The GravityModel passed to the constructor is not copied, so it must
+   * outlive the GravityGrid object.
+   *
+   * Example of use:
+   * \include example-GravityGrid.cpp
+   **********************************************************************/
+
+  class GEOGRAPHICLIB_EXPORT GravityGrid {
+  private:
+    typedef Math::real real;
+    const GravityModel& _model;
+    unsigned _quantity;
+    real _south, _west, _dlat, _dlon, _h;
+    int _nlat, _nlon;
+    // The number of rows (columns) per degree if this is used to compute the
+    // latitudes (longitudes) of the nodes, else 0
+    int _latdeg, _londeg;
+    static int perdegree(real d);
+    // The latitude of row i and the longitude of column j
+    real latitude(int i) const {
+      return _latdeg ? _south + i / _latdeg + (i % _latdeg) * _dlat :
+        _south + i * _dlat;
+    }
+    real longitude(int j) const {
+      return _londeg ? _west + j / _londeg + (j % _londeg) * _dlon :
+        _west + j * _dlon;
+    }
+    // The number of rows in a batch
+    int batchrows() const;
+    // Elapsed wall-clock time (seconds)
+    static double wallclock();
+    // Compute row i
+    void row(int i, real vals[]) const;
+    // Stream the grid to str; if northfirst, write the rows north to south;
+    // encoding is one of PGMBIG_, PGMLITTLE_, GTXFLOAT_.
+    enum encoding { PGMBIG_, PGMLITTLE_, GTXFLOAT_ };
+    void writerows(std::ostream& str, bool northfirst, encoding enc,
+                   real offset, real scale, std::ostream* log) const;
+    GravityGrid& operator=(const GravityGrid&); // copy assignment not allowed
+  public:
+
+    /**
+     * The quantities which may be computed.
+     **********************************************************************/
+    enum quantity {
+      /**
+       * The height of the geoid above the ellipsoid, \e N (meters), as
+       * returned by GravityCircle::GeoidHeight.
+       * @hideinitializer
+       **********************************************************************/
+      GEOID_HEIGHT = 0,
+      /**
+       * The gravity disturbance, &minus;&delta;<sub><i>z</i></sub> (m
+       * s<sup>&minus;2</sup>), i.e., the downward component of the
+       * disturbance vector returned by GravityCircle::Disturbance.  This is
+       * the difference of the magnitudes of gravity and normal gravity at the
+       * same point.
+       * @hideinitializer
+       **********************************************************************/
+      DISTURBANCE = 1,
+      /**
+       * The gravity anomaly, &Delta;<i>g</i><sub>01</sub> (m
+       * s<sup>&minus;2</sup>), as returned by
+       * GravityCircle::SphericalAnomaly.
+       * @hideinitializer
+       **********************************************************************/
+      ANOMALY = 2,
+    };
+
+    /**
+     * Constructor for a GravityGrid.
+     *
+     * @param[in] model the GravityModel to use.
+     * @param[in] q the GravityGrid::quantity to compute.
+     * @param[in] south the latitude of the southern row (degrees).
+     * @param[in] west the longitude of the western column (degrees).
+     * @param[in] dlat the spacing of the rows (degrees).
+     * @param[in] dlon the spacing of the columns (degrees).
+     * @param[in] nlat the number of rows.
+     * @param[in] nlon the number of columns.
+     * @param[in] h (optional) the height above the ellipsoid (meters) at
+     *   which the gravity disturbance and anomaly are computed; the default
+     *   is 0.  The geoid height is always computed with \e h = 0.
+     * @exception GeographicErr if \e q is not a valid quantity, if \e dlat,
+     *   \e dlon, \e nlat, or \e nlon is not positive, or if the rows extend
+     *   beyond the poles.
+     *
+     * Row \e i (for 0 &le; \e i &lt; \e nlat) is at latitude \e south + \e i
+     * \e dlat and column \e j (for 0 &le; \e j &lt; \e nlon) is at longitude
+     * \e west + \e j \e dlon.  For a grid which can be read by Geoid, set \e
+     * south = &minus;90, \e west = 0, \e dlat = \e dlon = 1/\e k, \e nlat =
+     * 180 \e k + 1, and \e nlon = 360 \e k for some integer \e k.  If \e
+     * dlat = 1/\e k, with \e k an integer which is not a power of 2, the
+     * latitude of row \e i is computed as \e south + floor(\e i/\e k) + (\e
+     * i mod \e k) \e dlat; this avoids the roundoff in \e i \e dlat, so
+     * that the nodes at whole degrees are exact.  Similarly for the
+     * longitudes.
+     **********************************************************************/
+    GravityGrid(const GravityModel& model, quantity q,
+                real south, real west, real dlat, real dlon,
+                int nlat, int nlon, real h = 0);
+
+    /**
+     * Compute rows of the grid.
+     *
+     * @param[in] i0 the first row.
+     * @param[in] n the number of rows.
+     * @param[out] vals an array of \e n &times; GravityGrid::NLon() values of
+     *   the quantity; the value for row \e i0 + \e i and column \e j is in
+     *   element \e i NLon() + \e j.
+     * @exception GeographicErr if the rows are out of range.
+     *
+     * The rows are computed in parallel if OpenMP is enabled.
+     **********************************************************************/
+    void Rows(int i0, int n, real vals[]) const;
+
+    /**
+     * Write the grid in PGM format.
+     *
+     * @param[in] filename the name of the output file.
+     * @param[in] offset the offset for converting the quantity to pixel
+     *   values.
+     * @param[in] scale the scale for converting the quantity to pixel
+     *   values.
+     * @param[in] native (optional) if true write the native little-endian
+     *   variant of the format (see Geoid::WriteNative); the default is
+     *   false.
+     * @param[in] log (optional) if non-null, report the progress and the
+     *   throughput to this stream after each batch of rows.
+     * @exception GeographicErr if \e scale is not positive or if the file
+     *   can't be written.
+     *
+     * The rows are written north to south and the pixel values are 16-bit
+     * integers \e p such that the quantity is \e offset + \e scale \e p.
+     * Values which can't be represented are clamped to [0, 65535] and the
+     * number of such values is reported to \e log.  For geoid heights, \e
+     * offset = &minus;108 and \e scale = 0.003 are suitable.  The header
+     * includes the Offset, Scale, Description, DateTime, and Origin comments
+     * used by Geoid.
+     **********************************************************************/
+    void WritePGM(const std::string& filename, real offset, real scale,
+                  bool native = false, std::ostream* log = 0) const;
+
+    /**
+     * Write the grid in GTX format.
+     *
+     * @param[in] filename the name of the output file.
+     * @param[in] log (optional) if non-null, report the progress and the
+     *   throughput to this stream after each batch of rows.
+     * @exception GeographicErr if the file can't be written.
+     *
+     * The GTX format consists of a big-endian header giving the south-west
+     * corner and spacings (doubles) and the numbers of rows and columns
+     * (integers), followed by the rows, south to north, as big-endian
+     * floats.  See http://vdatum.noaa.gov/docs/gtx_info.html
+     **********************************************************************/
+    void WriteGTX(const std::string& filename, std::ostream* log = 0) const;
+
+    /** \name Inspector functions
+     **********************************************************************/
+    ///@{
+    /**
+     * @return the GravityGrid::quantity being computed.
+     **********************************************************************/
+    quantity Quantity() const { return quantity(_quantity); }
+
+    /**
+     * @return the latitude of the southern row (degrees).
+     **********************************************************************/
+    Math::real South() const { return _south; }
+
+    /**
+     * @return the longitude of the western column (degrees).
+     **********************************************************************/
+    Math::real West() const { return _west; }
+
+    /**
+     * @return the spacing of the rows (degrees).
+     **********************************************************************/
+    Math::real LatitudeSpacing() const { return _dlat; }
+
+    /**
+     * @return the spacing of the columns (degrees).
+     **********************************************************************/
+    Math::real LongitudeSpacing() const { return _dlon; }
+
+    /**
+     * @return the number of rows.
+     **********************************************************************/
+    int NLat() const { return _nlat; }
+
+    /**
+     * @return the number of columns.
+     **********************************************************************/
+    int NLon() const { return _nlon; }
+
+    /**
+     * @return the height (meters) for the gravity disturbance and anomaly.
+     **********************************************************************/
+    Math::real Height() const { return _h; }
+
+    /**
+     * @return the maximum number of threads that GravityGrid::Rows will use.
+     *   This is 1 if the library was compiled without OpenMP.
+     **********************************************************************/
+    static int MaxThreads();
+    ///@}
+  };
+
+} // namespace geographic_lib
+
+#endif  // GEOGRAPHICLIB_GRAVITYGRID_HPP
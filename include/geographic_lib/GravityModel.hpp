@@ -98,6 +98,11 @@ namespace geographic_lib {
     Math::real InternalT(real X, real Y, real Z,
                          real& deltaX, real& deltaY, real& deltaZ,
                          bool gradp, bool correct) const;
+    // Convert the sum T (and its gradient) given by _disturbing into the
+    // disturbing potential (and the disturbance); used by InternalT.
+    Math::real FinishT(real X, real Y, real Z, real T,
+                       real& deltaX, real& deltaY, real& deltaZ,
+                       bool gradp, bool correct) const;
     GravityModel(const GravityModel&); // copy constructor not allowed
     GravityModel& operator=(const GravityModel&); // nor copy assignment
 
@@ -228,6 +233,34 @@ namespace geographic_lib {
                            real& deltax, real& deltay, real& deltaz)
       const;
 
+    /**
+     * Evaluate the gravity disturbance vector at several points.
+     *
+     * @param[in] n the number of points.
+     * @param[in] lat array of \e n geographic latitudes (degrees).
+     * @param[in] lon array of \e n geographic longitudes (degrees).
+     * @param[in] h array of \e n heights above the ellipsoid (meters).
+     * @param[out] deltax array of \e n easterly components of the
+     *   disturbance vector (m s<sup>&minus;2</sup>).
+     * @param[out] deltay array of \e n northerly components of the
+     *   disturbance vector (m s<sup>&minus;2</sup>).
+     * @param[out] deltaz array of \e n upward components of the disturbance
+     *   vector (m s<sup>&minus;2</sup>).
+     * @param[out] T array of \e n disturbing potentials
+     *   (m<sup>2</sup> s<sup>&minus;2</sup>).
+     *
+     * This gives the same results as calling
+     * GravityModel::Disturbance(real, real, real, real&, real&, real&) const
+     * for each point (to within roundoff).  However the spherical harmonic
+     * sums are evaluated for blocks of points with a single pass through the
+     * coefficients (see SphericalEngine::Values), which is substantially
+     * faster for scattered points.  (For points on a circle of latitude,
+     * GravityModel::Circle is faster still.)
+     **********************************************************************/
+    void Disturbance(size_t n, const real lat[], const real lon[],
+                     const real h[], real deltax[], real deltay[],
+                     real deltaz[], real T[]) const;
+
     /**
      * Evaluate the geoid height.
      *
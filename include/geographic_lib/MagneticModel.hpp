@@ -13,6 +13,7 @@
 #include <geographic_lib/Constants.hpp>
 #include <geographic_lib/Geocentric.hpp>
 #include <geographic_lib/SphericalHarmonic.hpp>
+#include <geographic_lib/SphericalHarmonic1.hpp>
 
 #if defined(_MSC_VER)
 // Squelch warnings about dll vs vector
@@ -23,6 +24,7 @@
 namespace geographic_lib {
 
   class MagneticCircle;
+  class MagneticSnapshot;
 
   /**
    * \brief Model of the earth's magnetic field
@@ -78,6 +80,18 @@ namespace geographic_lib {
     std::vector< std::vector<real> > _G;
     std::vector< std::vector<real> > _H;
     std::vector<SphericalHarmonic> _harm;
+    // For each time interval n, the rate of change of the coefficients,
+    // _Gt[n] and _Ht[n], and the coefficients of model n padded to the
+    // degree and order of the rate, _Gb[n] and _Hb[n].  _harm1[n] sums
+    // these as base + t * rate with a single traversal of the recursion.
+    std::vector< std::vector<real> > _Gt, _Ht, _Gb, _Hb;
+    std::vector<SphericalHarmonic> _harmt;
+    std::vector<SphericalHarmonic1> _harm1;
+    // Add f times the coefficients in c to (C, S), the coefficients for a
+    // sum of degree N and order M.
+    static void addcoeffs(real f, const SphericalEngine::coeff& c,
+                          int N, int M,
+                          std::vector<real>& C, std::vector<real>& S);
     void Field(real t, real lat, real lon, real h, bool diffp,
                real& Bx, real& By, real& Bz,
                real& Bxt, real& Byt, real& Bzt) const;
@@ -186,6 +200,28 @@ namespace geographic_lib {
      **********************************************************************/
     MagneticCircle Circle(real t, real lat, real h) const;
 
+    /**
+     * Create a MagneticSnapshot object to allow the geomagnetic field at many
+     * points at a fixed time \e t to be computed efficiently.
+     *
+     * @param[in] t the time (years).
+     * @exception std::bad_alloc if the memory necessary for creating a
+     *   MagneticSnapshot can't be allocated.
+     * @return a MagneticSnapshot object whose
+     *   MagneticSnapshot::operator()(real lat, real lon, real h, real& Bx,
+     *   real& By, real& Bz) const member function computes the field at a
+     *   particular point.
+     *
+     * The coefficients of the model are interpolated to time \e t (and the
+     * constant terms are added) when the MagneticSnapshot is created, so
+     * that the field at each point is given by a single spherical harmonic
+     * sum.  The results agree with MagneticModel::operator()() to within
+     * roundoff.  The MagneticSnapshot holds a copy of the coefficients
+     * (which is large for models with high-degree constant terms, such as
+     * emm2015) and may be shared between threads.
+     **********************************************************************/
+    MagneticSnapshot AtTime(real t) const;
+
     /**
      * Compute various quantities dependent on the magnetic field.
      *
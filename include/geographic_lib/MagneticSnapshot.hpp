@@ -0,0 +1,191 @@
+/**
+ * \file MagneticSnapshot.hpp
+ * \brief Header for geographic_lib::MagneticSnapshot class
+ *
+ * Copyright (c) 2026 the geographic_lib authors and licensed under the
+ * MIT/X11 License.  This file is not part of the upstream GeographicLib
+ * distribution; see https://geographiclib.sourceforge.io/ for that.
+ **********************************************************************/
+
+#if !defined(GEOGRAPHICLIB_MAGNETICSNAPSHOT_HPP)
+#define GEOGRAPHICLIB_MAGNETICSNAPSHOT_HPP 1
+
+#include <vector>
+#include <geographic_lib/Constants.hpp>
+#include <geographic_lib/Geocentric.hpp>
+#include <geographic_lib/SphericalHarmonic.hpp>
+
+#if defined(_MSC_VER)
+// Squelch warnings about dll vs vector
+#  pragma warning (push)
+#  pragma warning (disable: 4251)
+#endif
+
+namespace geographic_lib {
+
+  /**
+   * \brief Geomagnetic field at a fixed time
+   *
+   * Evaluate the earth's magnetic field at a particular time.  The
+   * coefficients of the magnetic model are interpolated (or extrapolated) to
+   * this time once, when the object is created, and the constant terms of
+   * the model (if any) are folded in.  Thereafter, the field at any point is
+   * given by a single spherical harmonic sum (and the rate of change of the
+   * field by a second sum).  This is faster than MagneticModel::operator()()
+   * if the field is needed at many points at the same time, e.g., at "the
+   * current time".
+   *
+   * Use MagneticModel::AtTime to create a MagneticSnapshot object.  (The
+   * constructor for this class is private.)  The object holds its own copy
+   * of the coefficients and so may outlive the MagneticModel.  The member
+   * functions are const and may be called concurrently from several threads.
+   *
+   * Example of use:
+   * \include example-MagneticSnapshot.cpp
+   **********************************************************************/
+
+  class GEOGRAPHICLIB_EXPORT MagneticSnapshot {
+  private:
+    typedef Math::real real;
+
+    real _a, _t;
+    Geocentric _earth;
+    int _N, _M, _Nt, _Mt;
+    SphericalHarmonic::normalization _norm;
+    // The coefficients of the field and of its rate of change
+    std::vector<real> _G, _H, _Gt, _Ht;
+    SphericalHarmonic _harm, _harmt;
+
+    // Takes ownership of the coefficients (which are swapped out of G, H,
+    // Gt, and Ht).
+    MagneticSnapshot(real a, const Geocentric& earth, real t,
+                     int N, int M, std::vector<real>& G, std::vector<real>& H,
+                     int Nt, int Mt,
+                     std::vector<real>& Gt, std::vector<real>& Ht,
+                     SphericalHarmonic::normalization norm);
+
+    // Point _harm and _harmt to the coefficients held by this object
+    void reset();
+
+    void Field(real lat, real lon, real h, bool diffp,
+               real& Bx, real& By, real& Bz,
+               real& Bxt, real& Byt, real& Bzt) const;
+
+    friend class MagneticModel; // MagneticModel calls the private constructor
+
+  public:
+
+    /**
+     * A default constructor for the magnetic snapshot.  This sets up an
+     * uninitialized object which can be later replaced by the
+     * MagneticModel::AtTime.
+     **********************************************************************/
+    MagneticSnapshot()
+      : _a(-1)
+      , _t(Math::NaN())
+      , _N(-1)
+      , _M(-1)
+      , _Nt(-1)
+      , _Mt(-1)
+      , _norm(SphericalHarmonic::SCHMIDT)
+    {}
+
+    /**
+     * The copy constructor.  (The spherical harmonic sums of the copy refer
+     * to its own coefficients.)
+     *
+     * @param[in] s the MagneticSnapshot to copy.
+     **********************************************************************/
+    MagneticSnapshot(const MagneticSnapshot& s);
+
+    /**
+     * The copy assignment operator.
+     *
+     * @param[in] s the MagneticSnapshot to copy.
+     * @return a reference to this object.
+     **********************************************************************/
+    MagneticSnapshot& operator=(const MagneticSnapshot& s);
+
+    /** \name Compute the magnetic field
+     **********************************************************************/
+    ///@{
+    /**
+     * Evaluate the components of the geomagnetic field.
+     *
+     * @param[in] lat latitude of the point (degrees).
+     * @param[in] lon longitude of the point (degrees).
+     * @param[in] h the height of the point above the ellipsoid (meters).
+     * @param[out] Bx the easterly component of the magnetic field (nanotesla).
+     * @param[out] By the northerly component of the magnetic field
+     *   (nanotesla).
+     * @param[out] Bz the vertical (up) component of the magnetic field
+     *   (nanotesla).
+     **********************************************************************/
+    void operator()(real lat, real lon, real h,
+                    real& Bx, real& By, real& Bz) const {
+      real dummy;
+      Field(lat, lon, h, false, Bx, By, Bz, dummy, dummy, dummy);
+    }
+
+    /**
+     * Evaluate the components of the geomagnetic field and their time
+     * derivatives
+     *
+     * @param[in] lat latitude of the point (degrees).
+     * @param[in] lon longitude of the point (degrees).
+     * @param[in] h the height of the point above the ellipsoid (meters).
+     * @param[out] Bx the easterly component of the magnetic field (nanotesla).
+     * @param[out] By the northerly component of the magnetic field
+     *   (nanotesla).
+     * @param[out] Bz the vertical (up) component of the magnetic field
+     *   (nanotesla).
+     * @param[out] Bxt the rate of change of \e Bx (nT/yr).
+     * @param[out] Byt the rate of change of \e By (nT/yr).
+     * @param[out] Bzt the rate of change of \e Bz (nT/yr).
+     **********************************************************************/
+    void operator()(real lat, real lon, real h,
+                    real& Bx, real& By, real& Bz,
+                    real& Bxt, real& Byt, real& Bzt) const {
+      Field(lat, lon, h, true, Bx, By, Bz, Bxt, Byt, Bzt);
+    }
+    ///@}
+
+    /** \name Inspector functions
+     **********************************************************************/
+    ///@{
+    /**
+     * @return true if the object has been initialized.
+     **********************************************************************/
+    bool Init() const { return _a > 0; }
+    /**
+     * @return \e a the equatorial radius of the ellipsoid (meters).  This is
+     *   the value inherited from the MagneticModel object used in the
+     *   constructor.
+     **********************************************************************/
+    Math::real MajorRadius() const
+    { return Init() ? _earth.MajorRadius() : Math::NaN(); }
+    /**
+     * @return \e f the flattening of the ellipsoid.  This is the value
+     *   inherited from the MagneticModel object used in the constructor.
+     **********************************************************************/
+    Math::real Flattening() const
+    { return Init() ? _earth.Flattening() : Math::NaN(); }
+    /**
+     * @return the time (fractional years).
+     **********************************************************************/
+    Math::real Time() const
+    { return Init() ? _t : Math::NaN(); }
+    /**
+     * @return the degree of the spherical harmonic sum for the field.
+     **********************************************************************/
+    int Degree() const { return Init() ? _N : -1; }
+    ///@}
+  };
+
+} // namespace geographic_lib
+
+#if defined(_MSC_VER)
+#  pragma warning (pop)
+#endif
+
+#endif  // GEOGRAPHICLIB_MAGNETICSNAPSHOT_HPP
@@ -36,6 +36,17 @@
 #  endif
 #endif
 
+/**
+ * Are C++11 threading facilities (std::mutex, etc.) available?
+ **********************************************************************/
+#if !defined(GEOGRAPHICLIB_CXX11_THREADS)
+#  if __cplusplus >= 201103 || (defined(_MSC_VER) && _MSC_VER >= 1700)
+#    define GEOGRAPHICLIB_CXX11_THREADS 1
+#  else
+#    define GEOGRAPHICLIB_CXX11_THREADS 0
+#  endif
+#endif
+
 #if !defined(GEOGRAPHICLIB_WORDS_BIGENDIAN)
 #  define GEOGRAPHICLIB_WORDS_BIGENDIAN 0
 #endif
@@ -150,6 +161,13 @@ namespace geographic_lib {
 #endif
     }
 
+    /**
+     * @tparam T the type of the real number.
+     * @return the number of bits of precision in a number of type \e T.
+     **********************************************************************/
+    template<typename T> static int digits()
+    { return std::numeric_limits<T>::digits; }
+
     /**
      * Set the binary precision of a real number.
      *
@@ -577,7 +595,7 @@ namespace geographic_lib {
       r -= 90 * q;
 #endif
       // now abs(r) <= 45
-      r *= degree();
+      r *= degree<T>();
       // Possibly could call the gnu extension sincos
       T s = sin(r), c = cos(r);
 #if defined(_MSC_VER) && _MSC_VER < 1900
@@ -621,7 +639,7 @@ namespace geographic_lib {
       r -= 90 * q;
 #endif
       // now abs(r) <= 45
-      r *= degree();
+      r *= degree<T>();
       unsigned p = unsigned(q);
       r = p & 1U ? cos(r) : sin(r);
       if (p & 2U) r = -r;
@@ -651,7 +669,7 @@ namespace geographic_lib {
       r -= 90 * q;
 #endif
       // now abs(r) <= 45
-      r *= degree();
+      r *= degree<T>();
       unsigned p = unsigned(q + 1);
       r = p & 1U ? cos(r) : sin(r);
       if (p & 2U) r = -r;
@@ -698,7 +716,7 @@ namespace geographic_lib {
       if (abs(y) > abs(x)) { std::swap(x, y); q = 2; }
       if (x < 0) { x = -x; ++q; }
       // here x >= 0 and x >= abs(y), so angle is in [-pi/4, pi/4]
-      T ang = atan2(y, x) / degree();
+      T ang = atan2(y, x) / degree<T>();
       switch (q) {
         // Note that atan2d(-0.0, 1.0) will return -0.  However, we expect that
         // atan2d will not be called with y = -0.  If need be, include
@@ -940,6 +958,13 @@ namespace geographic_lib {
 #endif
   };
 
+#if GEOGRAPHICLIB_PRECISION == 5
+  /// \cond SKIP
+  // The precision of mpreal is set at run time
+  template<> inline int Math::digits<Math::real>() { return Math::digits(); }
+  /// \endcond
+#endif
+
 } // namespace geographic_lib
 
 #endif  // GEOGRAPHICLIB_MATH_HPP
@@ -306,6 +306,40 @@ namespace geographic_lib {
                               real x, real y, real z, real a,
                               real& gradx, real& grady, real& gradz);
 
+    /**
+     * Evaluate a spherical harmonic sum and its gradient at several points.
+     *
+     * @tparam gradp should the gradient be calculated.
+     * @tparam norm the normalization for the associated Legendre polynomials.
+     * @tparam L the number of terms in the coefficients.
+     * @param[in] c an array of coeff objects.
+     * @param[in] f array of coefficient multipliers.  f[0] should be 1.
+     * @param[in] n the number of points.
+     * @param[in] x array of the \e x components of the positions.
+     * @param[in] y array of the \e y components of the positions.
+     * @param[in] z array of the \e z components of the positions.
+     * @param[in] a the normalizing radius.
+     * @param[out] v array of the spherical harmonic sums.
+     * @param[out] gradx array of the \e x components of the gradient.
+     * @param[out] grady array of the \e y components of the gradient.
+     * @param[out] gradz array of the \e z components of the gradient.
+     *
+     * This gives the same results as calling SphericalEngine::Value for each
+     * point (to within roundoff).  However, the points are processed in
+     * blocks of 8 with the Clenshaw recursions for the points in a block
+     * advancing together.  Each coefficient is then read once per block
+     * (instead of once per point), the factors in the recursion depending
+     * only on \e n and \e m are computed once per block, and the arithmetic
+     * for the points is done in loops which the compiler can vectorize.  The
+     * gradient arrays are not accessed if \e gradp is false (and so may then
+     * be null).  This function never throws an exception.
+     **********************************************************************/
+    template<bool gradp, normalization norm, int L>
+      static void Values(const coeff c[], const real f[], size_t n,
+                         const real x[], const real y[], const real z[],
+                         real a, real v[],
+                         real gradx[], real grady[], real gradz[]);
+
     /**
      * Create a CircularEngine object
      *
@@ -366,6 +400,64 @@ namespace geographic_lib {
       std::vector<real> temp(0);
       sqrttable().swap(temp);
     }
+
+    /**
+     * Set the minimum degree for parallel evaluation.
+     *
+     * @param[in] N the minimum degree (i.e., the value of coeff::nmx() for
+     *   the first set of coefficients) for which SphericalEngine::Value and
+     *   SphericalEngine::Circle are parallelized; a negative value (the
+     *   default) turns off the parallel evaluation.
+     *
+     * The inner sums over degree \e n for the various orders \e m are
+     * independent and account for nearly all the work in evaluating a sum.
+     * If the library is compiled with OpenMP enabled (e.g., by configuring
+     * with cmake -D USE_OPENMP=ON), these sums are handed out dynamically to
+     * the threads of an OpenMP team when \e N is at least this minimum
+     * degree; the outer sum over \e m is then carried out in the calling
+     * thread.  The results are identical to those computed serially.  This
+     * reduces the latency of a single evaluation of a high-degree model,
+     * e.g., GravityModel::Gravity with EGM2008 (\e N = 2190), on a machine
+     * with many cores.  A value of about 100 is suitable.
+     *
+     * Parallel evaluation is skipped if the call is made within an OpenMP
+     * parallel region (e.g., by GravityGrid) or if only one thread is
+     * available; and SphericalEngine::Value then needs temporary space
+     * proportional to \e N, so that it may throw std::bad_alloc.  This
+     * setting is shared by all threads; so set it at program start up.
+     **********************************************************************/
+    static void SetParallelDegree(int N) { paralleldegree() = N; }
+
+    /**
+     * @return the minimum degree for parallel evaluation (see
+     *   SphericalEngine::SetParallelDegree).
+     **********************************************************************/
+    static int ParallelDegree() { return paralleldegree(); }
+
+    /**
+     * @return the maximum number of threads used for parallel evaluation.
+     *   This is 1 if the library was compiled without OpenMP.
+     **********************************************************************/
+    static int MaxThreads();
+
+  private:
+    // The minimum degree for parallel evaluation
+    static int& paralleldegree();
+    // Should a sum of degree N be evaluated in parallel?
+    static bool parallel(int N);
+    // Evaluate the inner sums for order m; s[0..5] = Sc[m], Ss[m], and their
+    // derivatives with respect to r and theta (the last four only if gradp)
+    template<bool gradp, normalization norm, int L>
+      static void InnerSum(const coeff c[], const real f[], int m,
+                           real q, real t, real u, real s[]);
+    // The number of points evaluated together by Values
+    static const int lanes_ = 8;
+    // Evaluate the sums for n <= lanes_ points
+    template<bool gradp, normalization norm, int L>
+      static void ValueBlock(const coeff c[], const real f[], int n,
+                             const real x[], const real y[], const real z[],
+                             real a, real v[],
+                             real gradx[], real grady[], real gradz[]);
   };
 
 } // namespace geographic_lib
@@ -271,6 +271,67 @@ namespace geographic_lib {
       return v;
     }
 
+    /**
+     * Compute the spherical harmonic sum at several points.
+     *
+     * @param[in] n the number of points.
+     * @param[in] x array of \e n cartesian coordinates.
+     * @param[in] y array of \e n cartesian coordinates.
+     * @param[in] z array of \e n cartesian coordinates.
+     * @param[out] v array of \e n spherical harmonic sums.
+     *
+     * This gives the same results as calling the single-point function for
+     * each point (to within roundoff) but is faster for large \e N because the
+     * points are processed in blocks which share each pass through the
+     * coefficients; see SphericalEngine::Values.  This routine requires
+     * constant memory and thus never throws an exception.
+     **********************************************************************/
+    void operator()(size_t n, const real x[], const real y[],
+                    const real z[], real v[]) const {
+      real f[] = {1};
+      switch (_norm) {
+      case FULL:
+        SphericalEngine::Values<false, SphericalEngine::FULL, 1>
+          (_c, f, n, x, y, z, _a, v, 0, 0, 0);
+        break;
+      case SCHMIDT:
+        SphericalEngine::Values<false, SphericalEngine::SCHMIDT, 1>
+          (_c, f, n, x, y, z, _a, v, 0, 0, 0);
+        break;
+      }
+    }
+
+    /**
+     * Compute the spherical harmonic sum and its gradient at several points.
+     *
+     * @param[in] n the number of points.
+     * @param[in] x array of \e n cartesian coordinates.
+     * @param[in] y array of \e n cartesian coordinates.
+     * @param[in] z array of \e n cartesian coordinates.
+     * @param[out] v array of \e n spherical harmonic sums.
+     * @param[out] gradx array of \e n \e x components of the gradient.
+     * @param[out] grady array of \e n \e y components of the gradient.
+     * @param[out] gradz array of \e n \e z components of the gradient.
+     *
+     * This is the same as the previous function, except that the components
+     * of the gradients are computed.
+     **********************************************************************/
+    void operator()(size_t n, const real x[], const real y[],
+                    const real z[], real v[],
+                    real gradx[], real grady[], real gradz[]) const {
+      real f[] = {1};
+      switch (_norm) {
+      case FULL:
+        SphericalEngine::Values<true, SphericalEngine::FULL, 1>
+          (_c, f, n, x, y, z, _a, v, gradx, grady, gradz);
+        break;
+      case SCHMIDT:
+        SphericalEngine::Values<true, SphericalEngine::SCHMIDT, 1>
+          (_c, f, n, x, y, z, _a, v, gradx, grady, gradz);
+        break;
+      }
+    }
+
     /**
      * Create a CircularEngine to allow the efficient evaluation of several
      * points on a circle of latitude.
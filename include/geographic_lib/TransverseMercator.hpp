@@ -24,6 +24,20 @@
 
 namespace geographic_lib {
 
+  /// \cond SKIP
+  // The order of the series used by TransverseMercatorT<T>.  This is
+  // GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER, except that single precision uses
+  // the order that GEOGRAPHICLIB_PRECISION = 1 would select.
+  template<typename T> struct TransverseMercatorOrder {
+    static const int order = GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER;
+  };
+#if GEOGRAPHICLIB_PRECISION != 1
+  template<> struct TransverseMercatorOrder<float> {
+    static const int order = 4;
+  };
+#endif
+  /// \endcond
+
   /**
    * \brief Transverse Mercator projection
    *
@@ -78,6 +92,12 @@ namespace geographic_lib {
    * The meridian convergence is the bearing of grid north (the \e y axis)
    * measured clockwise from true north.
    *
+   * This is a templated class to allow the calculations to be carried out in
+   * a type \e T other than Math::real.  TransverseMercator (\e T =
+   * Math::real) and TransverseMercatorF (\e T = float) are instantiated in
+   * the library.  TransverseMercatorF uses 4th order series; its accuracy is
+   * limited by the float arithmetic to about 2 m.
+   *
    * See TransverseMercator.cpp for more information on the implementation.
    *
    * See \ref transversemercator for a discussion of this projection.
@@ -90,10 +110,11 @@ namespace geographic_lib {
    * TransverseMercator and TransverseMercatorExact.
    **********************************************************************/
 
-  class GEOGRAPHICLIB_EXPORT TransverseMercator {
+  template<typename T>
+  class TransverseMercatorT {
   private:
-    typedef Math::real real;
-    static const int maxpow_ = GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER;
+    typedef T real;
+    static const int maxpow_ = TransverseMercatorOrder<T>::order;
     static const int numit_ = 5;
     real _a, _f, _k0, _e2, _es, _e2m,  _c, _n;
     // _alp[0] and _bet[0] unused
@@ -111,7 +132,7 @@ namespace geographic_lib {
      * @exception GeographicErr if \e a, (1 &minus; \e f) \e a, or \e k0 is
      *   not positive.
      **********************************************************************/
-    TransverseMercator(real a, real f, real k0);
+    TransverseMercatorT(real a, real f, real k0);
 
     /**
      * Forward projection, from geographic to transverse Mercator.
@@ -172,19 +193,19 @@ namespace geographic_lib {
      * @return \e a the equatorial radius of the ellipsoid (meters).  This is
      *   the value used in the constructor.
      **********************************************************************/
-    Math::real MajorRadius() const { return _a; }
+    real MajorRadius() const { return _a; }
 
     /**
      * @return \e f the flattening of the ellipsoid.  This is the value used in
      *   the constructor.
      **********************************************************************/
-    Math::real Flattening() const { return _f; }
+    real Flattening() const { return _f; }
 
     /**
      * @return \e k0 central scale for the projection.  This is the value of \e
      *   k0 used in the constructor and is the scale on the central meridian.
      **********************************************************************/
-    Math::real CentralScale() const { return _k0; }
+    real CentralScale() const { return _k0; }
     ///@}
 
     /**
@@ -192,9 +213,31 @@ namespace geographic_lib {
      * and the UTM scale factor.  However, unlike UTM, no false easting or
      * northing is added.
      **********************************************************************/
-    static const TransverseMercator& UTM();
+    static const TransverseMercatorT& UTM();
   };
 
+  /**
+   * @relates TransverseMercatorT
+   * Transverse Mercator projection using Math::real.  Because this is a
+   * typedef, it cannot be forward declared with "class
+   * TransverseMercator;"; include this header instead.
+   **********************************************************************/
+  typedef TransverseMercatorT<Math::real> TransverseMercator;
+
+  /**
+   * @relates TransverseMercatorT
+   * Transverse Mercator projection using float.
+   **********************************************************************/
+  typedef TransverseMercatorT<float> TransverseMercatorF;
+
+  /// \cond SKIP
+  // The instantiations are compiled into (and exported from) the library.
+  extern template class GEOGRAPHICLIB_EXPORT TransverseMercatorT<Math::real>;
+#if GEOGRAPHICLIB_PRECISION != 1
+  extern template class GEOGRAPHICLIB_EXPORT TransverseMercatorT<float>;
+#endif
+  /// \endcond
+
 } // namespace geographic_lib
 
 #endif  // GEOGRAPHICLIB_TRANSVERSEMERCATOR_HPP
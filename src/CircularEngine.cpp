@@ -93,4 +93,118 @@ namespace geographic_lib {
     return vc;
   }
 
+  template<bool gradp>
+  void CircularEngine::ValueBlock(int n, const real sl[], const real cl[],
+                                  real v[], real gradx[], real grady[],
+                                  real gradz[]) const {
+    // This follows Value with the sums for the n longitudes held in arrays
+    // and with the coefficients, which are independent of longitude, hoisted
+    // out of the loops over the longitudes.  The arithmetic is otherwise the
+    // same, so that the results are identical.
+    const vector<real>& root( SphericalEngine::sqrttable() );
+    real
+      vc [lanes_], vc2 [lanes_], vs [lanes_], vs2 [lanes_],
+      vrc[lanes_], vrc2[lanes_], vrs[lanes_], vrs2[lanes_],
+      vtc[lanes_], vtc2[lanes_], vts[lanes_], vts2[lanes_],
+      vlc[lanes_], vlc2[lanes_], vls[lanes_], vls2[lanes_];
+    for (int l = 0; l < lanes_; ++l) {
+      vc [l] = vc2 [l] = vs [l] = vs2 [l] = 0;
+      vrc[l] = vrc2[l] = vrs[l] = vrs2[l] = 0;
+      vtc[l] = vtc2[l] = vts[l] = vts2[l] = 0;
+      vlc[l] = vlc2[l] = vls[l] = vls2[l] = 0;
+    }
+    for (int m = _M; m > 0; --m) {      // m = M .. 1
+      real w, B;
+      switch (_norm) {
+      case FULL:
+        w = root[2] * root[2 * m + 3] / root[m + 1];
+        B = - w * root[2 * m + 5] / (root[8] * root[m + 2]) * _uq2;
+        break;
+      case SCHMIDT:
+        w = root[2] * root[2 * m + 1] / root[m + 1];
+        B = - w * root[2 * m + 3] / (root[8] * root[m + 2]) * _uq2;
+        break;
+      default:
+        w = B = 0;
+      }
+      real
+        wc = _wc[m], ws = _ws[m],
+        wrc = gradp ? _wrc[m] : 0, wrs = gradp ? _wrs[m] : 0,
+        wtc = gradp ? _wtc[m] : 0, wts = gradp ? _wts[m] : 0;
+      for (int l = 0; l < n; ++l) {
+        real A = cl[l] * w * _uq, y;
+        y = A * vc [l] + B * vc2 [l] +  wc ; vc2 [l] = vc [l]; vc [l] = y;
+        y = A * vs [l] + B * vs2 [l] +  ws ; vs2 [l] = vs [l]; vs [l] = y;
+        if (gradp) {
+          y = A * vrc[l] + B * vrc2[l] +  wrc; vrc2[l] = vrc[l]; vrc[l] = y;
+          y = A * vrs[l] + B * vrs2[l] +  wrs; vrs2[l] = vrs[l]; vrs[l] = y;
+          y = A * vtc[l] + B * vtc2[l] +  wtc; vtc2[l] = vtc[l]; vtc[l] = y;
+          y = A * vts[l] + B * vts2[l] +  wts; vts2[l] = vts[l]; vts[l] = y;
+          y = A * vlc[l] + B * vlc2[l] + m*ws; vlc2[l] = vlc[l]; vlc[l] = y;
+          y = A * vls[l] + B * vls2[l] - m*wc; vls2[l] = vls[l]; vls[l] = y;
+        }
+      }
+    }
+    {                                   // m = 0
+      real A, B, qs, qr;
+      switch (_norm) {
+      case FULL:
+        A = root[3] * _uq;       // F[1]/(q*cl) or F[1]/(q*sl)
+        B = - root[15]/2 * _uq2; // beta[1]/q
+        break;
+      case SCHMIDT:
+        A = _uq;
+        B = - root[3]/2 * _uq2;
+        break;
+      default:
+        A = B = 0;
+      }
+      qs = _q / SphericalEngine::scale();
+      qr = qs / _r;
+      for (int l = 0; l < n; ++l) {
+        v[l] = qs * (_wc[0] + A * (cl[l] * vc[l] + sl[l] * vs[l]) +
+                     B * vc2[l]);
+        if (gradp) {
+          real
+            r =    - qr * (_wrc[0] + A * (cl[l] * vrc[l] + sl[l] * vrs[l]) +
+                           B * vrc2[l]),
+            t =      qr * (_wtc[0] + A * (cl[l] * vtc[l] + sl[l] * vts[l]) +
+                           B * vtc2[l]),
+            g = qr / _u * (          A * (cl[l] * vlc[l] + sl[l] * vls[l]) +
+                           B * vlc2[l]);
+          // Rotate into cartesian (geocentric) coordinates
+          gradx[l] = cl[l] * (_u * r + _t * t) - sl[l] * g;
+          grady[l] = sl[l] * (_u * r + _t * t) + cl[l] * g;
+          gradz[l] =              _t * r - _u * t            ;
+        }
+      }
+    }
+  }
+
+  void CircularEngine::Values(real lon0, real dlon, size_t n, real v[])
+    const {
+    real sl[lanes_], cl[lanes_], dummy[lanes_];
+    for (size_t j = 0; j < n; j += lanes_) {
+      int k = int(min(size_t(lanes_), n - j));
+      for (int l = 0; l < k; ++l)
+        Math::sincosd(lon0 + real(j + l) * dlon, sl[l], cl[l]);
+      ValueBlock<false>(k, sl, cl, v + j, dummy, dummy, dummy);
+    }
+  }
+
+  void CircularEngine::Values(real lon0, real dlon, size_t n, real v[],
+                              real gradx[], real grady[], real gradz[])
+    const {
+    real sl[lanes_], cl[lanes_];
+    for (size_t j = 0; j < n; j += lanes_) {
+      int k = int(min(size_t(lanes_), n - j));
+      for (int l = 0; l < k; ++l)
+        Math::sincosd(lon0 + real(j + l) * dlon, sl[l], cl[l]);
+      if (_gradp)
+        ValueBlock<true>(k, sl, cl, v + j, gradx + j, grady + j, gradz + j);
+      else
+        ValueBlock<false>(k, sl, cl, v + j, gradx + j, grady + j, gradz + j);
+    }
+  }
+
 } // namespace geographic_lib
@@ -39,8 +39,9 @@ namespace geographic_lib {
 
   using namespace std;
 
-  Geodesic::Geodesic(real a, real f)
-    : maxit2_(maxit1_ + Math::digits() + 10)
+  template<typename T>
+  GeodesicT<T>::GeodesicT(real a, real f)
+    : maxit2_(maxit1_ + Math::digits<real>() + 10)
       // Underflow guard.  We require
       //   tiny_ * epsilon() > 0
       //   tiny_ + epsilon() == epsilon()
@@ -86,14 +87,54 @@ namespace geographic_lib {
     C4coeff();
   }
 
-  const Geodesic& Geodesic::WGS84() {
-    static const Geodesic wgs84(Constants::WGS84_a(), Constants::WGS84_f());
+  template<typename T>
+  const GeodesicT<T>& GeodesicT<T>::WGS84() {
+    static const GeodesicT<T> wgs84(Constants::WGS84_a<T>(),
+                                   Constants::WGS84_f<T>());
     return wgs84;
   }
 
-  Math::real Geodesic::SinCosSeries(bool sinp,
-                                    real sinx, real cosx,
-                                    const real c[], int n) {
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+  template<typename T>
+  GeodesicStatistics& GeodesicT<T>::Stats() {
+#  if GEOGRAPHICLIB_CXX11_THREADS
+    static thread_local GeodesicStatistics stats;
+#  else
+    static GeodesicStatistics stats;
+#  endif
+    return stats;
+  }
+#endif
+
+  template<typename T>
+  GeodesicStatistics GeodesicT<T>::Statistics() {
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+    return Stats();
+#else
+    return GeodesicStatistics();
+#endif
+  }
+
+  template<typename T>
+  void GeodesicT<T>::ResetStatistics() {
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+    Stats().Reset();
+#endif
+  }
+
+  template<typename T>
+  void GeodesicT<T>::ReducedLatitude(real lat, real& sbet, real& cbet,
+                                     real& dn) const {
+    Math::sincosd(Math::AngRound(lat), sbet, cbet); sbet *= _f1;
+    // Ensure cbet = +epsilon at poles
+    Math::norm(sbet, cbet); cbet = max(tiny_, cbet);
+    dn = sqrt(1 + _ep2 * Math::sq(sbet));
+  }
+
+  template<typename T>
+  T GeodesicT<T>::SinCosSeries(bool sinp,
+                               real sinx, real cosx,
+                               const real c[], int n) {
     // Evaluate
     // y = sinp ? sum(c[i] * sin( 2*i    * x), i, 1, n) :
     //            sum(c[i] * cos((2*i+1) * x), i, 0, n-1)
@@ -115,53 +156,131 @@ namespace geographic_lib {
       : cosx * (y0 - y1);       // cos(x) * (y0 - y1)
   }
 
-  GeodesicLine Geodesic::Line(real lat1, real lon1, real azi1,
-                              unsigned caps) const {
-    return GeodesicLine(*this, lat1, lon1, azi1, caps);
+  template<typename T>
+  GeodesicLineT<T> GeodesicT<T>::Line(real lat1, real lon1, real azi1,
+                                      unsigned caps) const {
+    return GeodesicLineT<T>(*this, lat1, lon1, azi1, caps);
   }
 
-  Math::real Geodesic::GenDirect(real lat1, real lon1, real azi1,
-                                 bool arcmode, real s12_a12, unsigned outmask,
-                                 real& lat2, real& lon2, real& azi2,
-                                 real& s12, real& m12, real& M12, real& M21,
-                                 real& S12) const {
+  template<typename T>
+  T GeodesicT<T>::GenDirect(real lat1, real lon1, real azi1,
+                            bool arcmode, real s12_a12, unsigned outmask,
+                            real& lat2, real& lon2, real& azi2,
+                            real& s12, real& m12, real& M12, real& M21,
+                            real& S12) const {
     // Automatically supply DISTANCE_IN if necessary
     if (!arcmode) outmask |= DISTANCE_IN;
-    return GeodesicLine(*this, lat1, lon1, azi1, outmask)
+    return GeodesicLineT<T>(*this, lat1, lon1, azi1, outmask)
       .                         // Note the dot!
       GenPosition(arcmode, s12_a12, outmask,
                   lat2, lon2, azi2, s12, m12, M12, M21, S12);
   }
 
-  GeodesicLine Geodesic::GenDirectLine(real lat1, real lon1, real azi1,
-                                       bool arcmode, real s12_a12,
-                                       unsigned caps) const {
+  template<typename T>
+  void GeodesicT<T>::GenDirectBatch(size_t n,
+                                    const real lat1[], const real lon1[],
+                                    const real azi1[], bool arcmode,
+                                    const real s12_a12[], unsigned outmask,
+                                    real a12[],
+                                    real lat2[], real lon2[], real azi2[],
+                                    real s12[], real m12[], real M12[],
+                                    real M21[], real S12[]) const {
+    // Automatically supply DISTANCE_IN if necessary
+    if (!arcmode) outmask |= DISTANCE_IN;
+    unsigned out = outmask & OUT_MASK;
+    bool
+      latp = (out & LATITUDE) != 0,
+      lonp = (out & LONGITUDE) != 0,
+      azip = (out & AZIMUTH) != 0,
+      distp = (out & DISTANCE) != 0,
+      redlp = (out & REDUCEDLENGTH) != 0,
+      scalep = (out & GEODESICSCALE) != 0,
+      areap = (out & AREA) != 0;
+    GeodesicLineT<T> l;
+    // The reduced latitude and the coefficients for the line are only
+    // recomputed when the starting latitude or the starting point and azimuth
+    // change.  The comparisons are false for NaNs, forcing a recomputation.
+    real latx = Math::NaN<real>(), lonx = latx, azix = latx,
+      sbet1 = 0, cbet1 = 0, dn1 = 0;
+    for (size_t i = 0; i < n; ++i) {
+      if (!(lat1[i] == latx && lon1[i] == lonx && azi1[i] == azix)) {
+        if (!(lat1[i] == latx)) {
+          latx = lat1[i];
+          ReducedLatitude(Math::LatFix(latx), sbet1, cbet1, dn1);
+        }
+        lonx = lon1[i]; azix = azi1[i];
+        real azi = Math::AngNormalize(azix), salp1, calp1;
+        // Guard against underflow in salp0.  Also -0 is converted to +0.
+        Math::sincosd(Math::AngRound(azi), salp1, calp1);
+        l.LineInit(*this, latx, lonx, azi, salp1, calp1,
+                   sbet1, cbet1, dn1, outmask);
+      }
+      real lat2x, lon2x, azi2x, s12x, m12x, M12x, M21x, S12x,
+        a12x = l.GenPosition(arcmode, s12_a12[i], outmask,
+                             lat2x, lon2x, azi2x, s12x,
+                             m12x, M12x, M21x, S12x);
+      if (a12) a12[i] = a12x;
+      if (latp) lat2[i] = lat2x;
+      if (lonp) lon2[i] = lon2x;
+      if (azip) azi2[i] = azi2x;
+      if (distp) s12[i] = s12x;
+      if (redlp) m12[i] = m12x;
+      if (scalep) { M12[i] = M12x; M21[i] = M21x; }
+      if (areap) S12[i] = S12x;
+    }
+  }
+
+  template<typename T>
+  GeodesicLineT<T> GeodesicT<T>::GenDirectLine(real lat1, real lon1, real azi1,
+                                               bool arcmode, real s12_a12,
+                                               unsigned caps) const {
     azi1 = Math::AngNormalize(azi1);
     real salp1, calp1;
     // Guard against underflow in salp0.  Also -0 is converted to +0.
     Math::sincosd(Math::AngRound(azi1), salp1, calp1);
     // Automatically supply DISTANCE_IN if necessary
     if (!arcmode) caps |= DISTANCE_IN;
-    return GeodesicLine(*this, lat1, lon1, azi1, salp1, calp1,
-                        caps, arcmode, s12_a12);
+    return GeodesicLineT<T>(*this, lat1, lon1, azi1, salp1, calp1,
+                            caps, arcmode, s12_a12);
   }
 
-  GeodesicLine Geodesic::DirectLine(real lat1, real lon1, real azi1, real s12,
-                                    unsigned caps) const {
+  template<typename T>
+  GeodesicLineT<T> GeodesicT<T>::DirectLine(real lat1, real lon1,
+                                            real azi1, real s12,
+                                            unsigned caps) const {
     return GenDirectLine(lat1, lon1, azi1, false, s12, caps);
   }
 
-  GeodesicLine Geodesic::ArcDirectLine(real lat1, real lon1, real azi1,
-                                       real a12, unsigned caps) const {
+  template<typename T>
+  GeodesicLineT<T> GeodesicT<T>::ArcDirectLine(real lat1, real lon1, real azi1,
+                                               real a12, unsigned caps) const {
     return GenDirectLine(lat1, lon1, azi1, true, a12, caps);
   }
 
-  Math::real Geodesic::GenInverse(real lat1, real lon1, real lat2, real lon2,
-                                  unsigned outmask, real& s12,
-                                  real& salp1, real& calp1,
-                                  real& salp2, real& calp2,
-                                  real& m12, real& M12, real& M21,
-                                  real& S12) const {
+  template<typename T>
+  void GeodesicT<T>::InverseTerms(real lat, real rl[]) const {
+    // This duplicates the steps in GenInverse so that the results are
+    // identical.
+    rl[0] = lat = Math::AngRound(Math::LatFix(lat));
+    for (int k = 1; k < nrl_; k += 3) {
+      real& sbet = rl[k]; real& cbet = rl[k + 1];
+      Math::sincosd(k == 1 ? lat : -lat, sbet, cbet); sbet *= _f1;
+      Math::norm(sbet, cbet); cbet = max(tiny_, cbet);
+      rl[k + 2] = sqrt(1 + _ep2 * Math::sq(sbet));
+    }
+  }
+
+  template<typename T>
+  T GeodesicT<T>::GenInverse(real lat1, real lon1, real lat2, real lon2,
+                             const real rl1[], const real rl2[],
+                             unsigned outmask, real& s12,
+                             real& salp1, real& calp1,
+                             real& salp2, real& calp2,
+                             real& m12, real& M12, real& M21,
+                             real& S12) const {
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+    ++Stats().inverse;
+#endif
     // Compute longitude difference (AngDiff does this carefully).  Result is
     // in [-180, 180] but -180 is only for west-going geodesics.  180 is for
     // east-going and meridional geodesics.
@@ -172,7 +291,7 @@ namespace geographic_lib {
     lon12 = lonsign * Math::AngRound(lon12);
     lon12s = Math::AngRound((180 - lon12) - lonsign * lon12s);
     real
-      lam12 = lon12 * Math::degree(),
+      lam12 = lon12 * Math::degree<real>(),
       slam12, clam12;
     if (lon12 > 90) {
       Math::sincosd(lon12s, slam12, clam12);
@@ -181,14 +300,15 @@ namespace geographic_lib {
       Math::sincosd(lon12, slam12, clam12);
 
     // If really close to the equator, treat as on equator.
-    lat1 = Math::AngRound(Math::LatFix(lat1));
-    lat2 = Math::AngRound(Math::LatFix(lat2));
+    lat1 = rl1 ? rl1[0] : Math::AngRound(Math::LatFix(lat1));
+    lat2 = rl2 ? rl2[0] : Math::AngRound(Math::LatFix(lat2));
     // Swap points so that point with higher (abs) latitude is point 1
     // If one latitude is a nan, then it becomes lat1.
     int swapp = abs(lat1) < abs(lat2) ? -1 : 1;
     if (swapp < 0) {
       lonsign *= -1;
       swap(lat1, lat2);
+      swap(rl1, rl2);
     }
     // Make lat1 <= 0
     int latsign = lat1 < 0 ? 1 : -1;
@@ -206,16 +326,27 @@ namespace geographic_lib {
     // check, e.g., on verifying quadrants in atan2.  In addition, this
     // enforces some symmetries in the results returned.
 
-    real sbet1, cbet1, sbet2, cbet2, s12x, m12x;
+    real sbet1, cbet1, sbet2, cbet2, s12x, m12x, dn1, dn2;
 
-    Math::sincosd(lat1, sbet1, cbet1); sbet1 *= _f1;
-    // Ensure cbet1 = +epsilon at poles; doing the fix on beta means that sig12
-    // will be <= 2*tiny for two points at the same pole.
-    Math::norm(sbet1, cbet1); cbet1 = max(tiny_, cbet1);
+    if (rl1 && rl2) {
+      // Use the values computed by InverseTerms for the latitudes (or their
+      // negatives if latsign < 0).
+      rl1 += latsign > 0 ? 1 : 4; rl2 += latsign > 0 ? 1 : 4;
+      sbet1 = rl1[0]; cbet1 = rl1[1]; dn1 = rl1[2];
+      sbet2 = rl2[0]; cbet2 = rl2[1]; dn2 = rl2[2];
+    } else {
+      Math::sincosd(lat1, sbet1, cbet1); sbet1 *= _f1;
+      // Ensure cbet1 = +epsilon at poles; doing the fix on beta means that
+      // sig12 will be <= 2*tiny for two points at the same pole.
+      Math::norm(sbet1, cbet1); cbet1 = max(tiny_, cbet1);
 
-    Math::sincosd(lat2, sbet2, cbet2); sbet2 *= _f1;
-    // Ensure cbet2 = +epsilon at poles
-    Math::norm(sbet2, cbet2); cbet2 = max(tiny_, cbet2);
+      Math::sincosd(lat2, sbet2, cbet2); sbet2 *= _f1;
+      // Ensure cbet2 = +epsilon at poles
+      Math::norm(sbet2, cbet2); cbet2 = max(tiny_, cbet2);
+
+      dn1 = sqrt(1 + _ep2 * Math::sq(sbet1));
+      dn2 = sqrt(1 + _ep2 * Math::sq(sbet2));
+    }
 
     // If cbet1 < -sbet1, then cbet2 - cbet1 is a sensitive measure of the
     // |bet1| - |bet2|.  Alternatively (cbet1 >= -sbet1), abs(sbet2) + sbet1 is
@@ -226,17 +357,15 @@ namespace geographic_lib {
     // which failed with Visual Studio 10 (Release and Debug)
 
     if (cbet1 < -sbet1) {
-      if (cbet2 == cbet1)
+      if (cbet2 == cbet1) {
         sbet2 = sbet2 < 0 ? sbet1 : -sbet1;
+        dn2 = dn1;
+      }
     } else {
       if (abs(sbet2) == -sbet1)
         cbet2 = cbet1;
     }
 
-    real
-      dn1 = sqrt(1 + _ep2 * Math::sq(sbet1)),
-      dn2 = sqrt(1 + _ep2 * Math::sq(sbet2));
-
     real a12, sig12;
     // index zero element of this array is unused
     real Ca[nC_];
@@ -278,7 +407,7 @@ namespace geographic_lib {
           sig12 = m12x = s12x = 0;
         m12x *= _b;
         s12x *= _b;
-        a12 = sig12 / Math::degree();
+        a12 = sig12 / Math::degree<real>();
       } else
         // m12 < 0, i.e., prolate and too close to anti-podal
         meridian = false;
@@ -317,7 +446,7 @@ namespace geographic_lib {
         m12x = Math::sq(dnm) * _b * sin(sig12 / dnm);
         if (outmask & GEODESICSCALE)
           M12 = M21 = cos(sig12 / dnm);
-        a12 = sig12 / Math::degree();
+        a12 = sig12 / Math::degree<real>();
         omg12 = lam12 / (_f1 * dnm);
       } else {
 
@@ -338,6 +467,9 @@ namespace geographic_lib {
         unsigned numit = 0;
         // Bracketing range
         real salp1a = tiny_, calp1a = 1, salp1b = tiny_, calp1b = -1;
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+        bool bisected = false;
+#endif
         for (bool tripn = false, tripb = false;
              numit < maxit2_ || GEOGRAPHICLIB_PANIC;
              ++numit) {
@@ -361,7 +493,7 @@ namespace geographic_lib {
             real
               sdalp1 = sin(dalp1), cdalp1 = cos(dalp1),
               nsalp1 = salp1 * cdalp1 + calp1 * sdalp1;
-            if (nsalp1 > 0 && abs(dalp1) < Math::pi()) {
+            if (nsalp1 > 0 && abs(dalp1) < Math::pi<real>()) {
               calp1 = calp1 * cdalp1 - salp1 * sdalp1;
               salp1 = nsalp1;
               Math::norm(salp1, calp1);
@@ -380,6 +512,9 @@ namespace geographic_lib {
           // 90deg:
           // the WGS84 test set: mean = 5.21, sd = 3.93, max = 24
           // WGS84 and random input: mean = 4.74, sd = 0.99
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+          bisected = true;
+#endif
           salp1 = (salp1a + salp1b)/2;
           calp1 = (calp1a + calp1b)/2;
           Math::norm(salp1, calp1);
@@ -387,6 +522,9 @@ namespace geographic_lib {
           tripb = (abs(salp1a - salp1) + (calp1a - calp1) < tolb_ ||
                    abs(salp1 - salp1b) + (calp1 - calp1b) < tolb_);
         }
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+        Stats().AddIterative(numit, maxit1_, maxit2_, bisected);
+#endif
         {
           real dummy;
           // Ensure that the reduced length and geodesic scale are computed in
@@ -398,7 +536,7 @@ namespace geographic_lib {
         }
         m12x *= _b;
         s12x *= _b;
-        a12 = sig12 / Math::degree();
+        a12 = sig12 / Math::degree<real>();
         if (outmask & AREA) {
           // omg12 = lam12 - domg12
           real sdomg12 = sin(domg12), cdomg12 = cos(domg12);
@@ -490,14 +628,15 @@ namespace geographic_lib {
     return a12;
   }
 
-  Math::real Geodesic::GenInverse(real lat1, real lon1, real lat2, real lon2,
-                                  unsigned outmask,
-                                  real& s12, real& azi1, real& azi2,
-                                  real& m12, real& M12, real& M21,
-                                  real& S12) const {
+  template<typename T>
+  T GeodesicT<T>::GenInverse(real lat1, real lon1, real lat2, real lon2,
+                             unsigned outmask,
+                             real& s12, real& azi1, real& azi2,
+                             real& m12, real& M12, real& M21,
+                             real& S12) const {
     outmask &= OUT_MASK;
     real salp1, calp1, salp2, calp2,
-      a12 =  GenInverse(lat1, lon1, lat2, lon2,
+      a12 =  GenInverse(lat1, lon1, lat2, lon2, 0, 0,
                         outmask, s12, salp1, calp1, salp2, calp2,
                         m12, M12, M21, S12);
     if (outmask & AZIMUTH) {
@@ -507,11 +646,84 @@ namespace geographic_lib {
     return a12;
   }
 
-  GeodesicLine Geodesic::InverseLine(real lat1, real lon1,
-                                     real lat2, real lon2,
-                                     unsigned caps) const {
+  template<typename T>
+  T GeodesicT<T>::GenInverse(const GeodesicPointT<T>& p1,
+                             const GeodesicPointT<T>& p2,
+                             unsigned outmask,
+                             real& s12, real& azi1, real& azi2,
+                             real& m12, real& M12, real& M21,
+                             real& S12) const {
+    outmask &= OUT_MASK;
+    real salp1, calp1, salp2, calp2,
+      a12 =  GenInverse(p1._lat, p1._lon, p2._lat, p2._lon, p1._rl, p2._rl,
+                        outmask, s12, salp1, calp1, salp2, calp2,
+                        m12, M12, M21, S12);
+    if (outmask & AZIMUTH) {
+      azi1 = Math::atan2d(salp1, calp1);
+      azi2 = Math::atan2d(salp2, calp2);
+    }
+    return a12;
+  }
+
+  template<typename T>
+  void GeodesicT<T>::InverseBatch(size_t n,
+                                  const real lat1[], const real lon1[],
+                                  const real lat2[], const real lon2[],
+                                  unsigned outmask, real a12[],
+                                  real s12[], real azi1[], real azi2[],
+                                  real m12[], real M12[], real M21[],
+                                  real S12[]) const {
+    outmask &= OUT_MASK;
+    // The flags are tested once here rather than once per point.
+    bool
+      distp = (outmask & DISTANCE) != 0,
+      azip = (outmask & AZIMUTH) != 0,
+      redlp = (outmask & REDUCEDLENGTH) != 0,
+      scalep = (outmask & GEODESICSCALE) != 0,
+      areap = (outmask & AREA) != 0;
+    // rl1 and rl2 hold the InverseTerms for latitudes lat1x and lat2x if ok1
+    // and ok2 are set.  These are only computed if a latitude is repeated in
+    // consecutive entries (a row of a grid or one point to many), because
+    // InverseTerms does more work than GenInverse does for a single
+    // latitude.
+    real rl1[nrl_], rl2[nrl_], lat1x = 0, lat2x = 0;
+    bool ok1 = false, ok2 = false;
+    for (size_t i = 0; i < n; ++i) {
+      if (!(ok1 && lat1[i] == lat1x)) {
+        ok1 = i + 1 < n && lat1[i + 1] == lat1[i];
+        if (ok1) InverseTerms(lat1x = lat1[i], rl1);
+      }
+      if (!(ok2 && lat2[i] == lat2x)) {
+        ok2 = i + 1 < n && lat2[i + 1] == lat2[i];
+        if (ok2) InverseTerms(lat2x = lat2[i], rl2);
+      }
+      // GenInverse needs the terms for both latitudes or for neither.
+      bool rlp = ok1 || ok2;
+      if (rlp && !ok1) { InverseTerms(lat1x = lat1[i], rl1); ok1 = true; }
+      if (rlp && !ok2) { InverseTerms(lat2x = lat2[i], rl2); ok2 = true; }
+      real s12x, salp1, calp1, salp2, calp2, m12x, M12x, M21x, S12x,
+        a12x = GenInverse(lat1[i], lon1[i], lat2[i], lon2[i],
+                          rlp ? rl1 : 0, rlp ? rl2 : 0,
+                          outmask, s12x, salp1, calp1, salp2, calp2,
+                          m12x, M12x, M21x, S12x);
+      if (a12) a12[i] = a12x;
+      if (distp) s12[i] = s12x;
+      if (azip) {
+        azi1[i] = Math::atan2d(salp1, calp1);
+        azi2[i] = Math::atan2d(salp2, calp2);
+      }
+      if (redlp) m12[i] = m12x;
+      if (scalep) { M12[i] = M12x; M21[i] = M21x; }
+      if (areap) S12[i] = S12x;
+    }
+  }
+
+  template<typename T>
+  GeodesicLineT<T> GeodesicT<T>::InverseLine(real lat1, real lon1,
+                                             real lat2, real lon2,
+                                             unsigned caps) const {
     real t, salp1, calp1, salp2, calp2,
-      a12 = GenInverse(lat1, lon1, lat2, lon2,
+      a12 = GenInverse(lat1, lon1, lat2, lon2, 0, 0,
                        // No need to specify AZIMUTH here
                        0u, t, salp1, calp1, salp2, calp2,
                        t, t, t, t),
@@ -519,17 +731,18 @@ namespace geographic_lib {
     // Ensure that a12 can be converted to a distance
     if (caps & (OUT_MASK & DISTANCE_IN)) caps |= DISTANCE;
     return
-      GeodesicLine(*this, lat1, lon1, azi1, salp1, calp1, caps, true, a12);
+      GeodesicLineT<T>(*this, lat1, lon1, azi1, salp1, calp1, caps, true, a12);
   }
 
-  void Geodesic::Lengths(real eps, real sig12,
-                         real ssig1, real csig1, real dn1,
-                         real ssig2, real csig2, real dn2,
-                         real cbet1, real cbet2, unsigned outmask,
-                         real& s12b, real& m12b, real& m0,
-                         real& M12, real& M21,
-                         // Scratch area of the right size
-                         real Ca[]) const {
+  template<typename T>
+  void GeodesicT<T>::Lengths(real eps, real sig12,
+                             real ssig1, real csig1, real dn1,
+                             real ssig2, real csig2, real dn2,
+                             real cbet1, real cbet2, unsigned outmask,
+                             real& s12b, real& m12b, real& m0,
+                             real& M12, real& M21,
+                             // Scratch area of the right size
+                             real Ca[]) const {
     // Return m12b = (reduced length)/_b; also calculate s12b = distance/_b,
     // and m0 = coefficient of secular term in expression for reduced length.
 
@@ -584,8 +797,13 @@ namespace geographic_lib {
     }
   }
 
-  Math::real Geodesic::Astroid(real x, real y) {
+  // The template parameter is called U here because T is used as a variable.
+  template<typename U>
+  U GeodesicT<U>::Astroid(real x, real y) {
     // Solve k^4+2*k^3-(x^2+y^2-1)*k^2-2*y^2*k-y^2 = 0 for positive root k.
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+    ++Stats().astroid;
+#endif
     // This solution is adapted from Geocentric::Reverse.
     real k;
     real
@@ -636,16 +854,17 @@ namespace geographic_lib {
     return k;
   }
 
-  Math::real Geodesic::InverseStart(real sbet1, real cbet1, real dn1,
-                                    real sbet2, real cbet2, real dn2,
-                                    real lam12, real slam12, real clam12,
-                                    real& salp1, real& calp1,
-                                    // Only updated if return val >= 0
-                                    real& salp2, real& calp2,
-                                    // Only updated for short lines
-                                    real& dnm,
-                                    // Scratch area of the right size
-                                    real Ca[]) const {
+  template<typename T>
+  T GeodesicT<T>::InverseStart(real sbet1, real cbet1, real dn1,
+                               real sbet2, real cbet2, real dn2,
+                               real lam12, real slam12, real clam12,
+                               real& salp1, real& calp1,
+                               // Only updated if return val >= 0
+                               real& salp2, real& calp2,
+                               // Only updated for short lines
+                               real& dnm,
+                               // Scratch area of the right size
+                               real Ca[]) const {
     // Return a starting point for Newton's method in salp1 and calp1 (function
     // value is -1).  If Newton's method doesn't need to be used, return also
     // salp2 and calp2 and function value is sig12.
@@ -705,7 +924,7 @@ namespace geographic_lib {
       sig12 = atan2(ssig12, csig12);
     } else if (abs(_n) > real(0.1) || // Skip astroid calc if too eccentric
                csig12 >= 0 ||
-               ssig12 >= 6 * abs(_n) * Math::pi() * Math::sq(cbet1)) {
+               ssig12 >= 6 * abs(_n) * Math::pi<real>() * Math::sq(cbet1)) {
       // Nothing to do, zeroth order spherical approximation is OK
     } else {
       // Scale lam12 and bet2 to x, y coordinate system where antipodal point
@@ -722,7 +941,7 @@ namespace geographic_lib {
           real
             k2 = Math::sq(sbet1) * _ep2,
             eps = k2 / (2 * (1 + sqrt(1 + k2)) + k2);
-          lamscale = _f * cbet1 * A3f(eps) * Math::pi();
+          lamscale = _f * cbet1 * A3f(eps) * Math::pi<real>();
         }
         betscale = lamscale * cbet1;
 
@@ -736,13 +955,13 @@ namespace geographic_lib {
         real m12b, m0, dummy;
         // In the case of lon12 = 180, this repeats a calculation made in
         // Inverse.
-        Lengths(_n, Math::pi() + bet12a,
+        Lengths(_n, Math::pi<real>() + bet12a,
                 sbet1, -cbet1, dn1, sbet2, cbet2, dn2,
                 cbet1, cbet2,
                 REDUCEDLENGTH, dummy, m12b, m0, dummy, dummy, Ca);
-        x = -1 + m12b / (cbet1 * cbet2 * m0 * Math::pi());
+        x = -1 + m12b / (cbet1 * cbet2 * m0 * Math::pi<real>());
         betscale = x < -real(0.01) ? sbet12a / x :
-          -_f * Math::sq(cbet1) * Math::pi();
+          -_f * Math::sq(cbet1) * Math::pi<real>();
         lamscale = betscale / cbet1;
         y = lam12x / lamscale;
       }
@@ -809,18 +1028,19 @@ namespace geographic_lib {
     return sig12;
   }
 
-  Math::real Geodesic::Lambda12(real sbet1, real cbet1, real dn1,
-                                real sbet2, real cbet2, real dn2,
-                                real salp1, real calp1,
-                                real slam120, real clam120,
-                                real& salp2, real& calp2,
-                                real& sig12,
-                                real& ssig1, real& csig1,
-                                real& ssig2, real& csig2,
-                                real& eps, real& domg12,
-                                bool diffp, real& dlam12,
-                                // Scratch area of the right size
-                                real Ca[]) const {
+  template<typename T>
+  T GeodesicT<T>::Lambda12(real sbet1, real cbet1, real dn1,
+                           real sbet2, real cbet2, real dn2,
+                           real salp1, real calp1,
+                           real slam120, real clam120,
+                           real& salp2, real& calp2,
+                           real& sig12,
+                           real& ssig1, real& csig1,
+                           real& ssig2, real& csig2,
+                           real& eps, real& domg12,
+                           bool diffp, real& dlam12,
+                           // Scratch area of the right size
+                           real Ca[]) const {
 
     if (sbet1 == 0 && calp1 == 0)
       // Break degeneracy of equatorial line.  This case has already been
@@ -896,12 +1116,14 @@ namespace geographic_lib {
     return lam12;
   }
 
-  Math::real Geodesic::A3f(real eps) const {
+  template<typename T>
+  T GeodesicT<T>::A3f(real eps) const {
     // Evaluate A3
     return Math::polyval(nA3_ - 1, _A3x, eps);
   }
 
-  void Geodesic::C3f(real eps, real c[]) const {
+  template<typename T>
+  void GeodesicT<T>::C3f(real eps, real c[]) const {
     // Evaluate C3 coeffs
     // Elements c[1] thru c[nC3_ - 1] are set
     real mult = 1;
@@ -915,7 +1137,8 @@ namespace geographic_lib {
     // Post condition: o == nC3x_
   }
 
-  void Geodesic::C4f(real eps, real c[]) const {
+  template<typename T>
+  void GeodesicT<T>::C4f(real eps, real c[]) const {
     // Evaluate C4 coeffs
     // Elements c[0] thru c[nC4_ - 1] are set
     real mult = 1;
@@ -949,36 +1172,46 @@ namespace geographic_lib {
   //   C3coeff       = (N - 1) * (N^2 + 7*N - 2*floor(N/2)) / 8
   //   C4coeff       = N * (N + 1) * (N + 5) / 6
   //
-  // where N = GEOGRAPHICLIB_GEODESIC_ORDER
+  // where N = GeodesicOrder<T>::order
   //         = nA1 = nA2 = nC1 = nC1p = nA3 = nC4
+  //
+  // The arrays for each order are the static members coeff of partial
+  // specializations of class templates, e.g., GeodesicC1fCoeff<T, N>.  (For
+  // A1m1f and A2m1f, the second template parameter is floor(N/2).)  In this
+  // way, only the arrays for the orders in use are instantiated.
+
+  /// \cond SKIP
+#define GEOGRAPHICLIB_GEODESIC_COEFF(name, N)                           \
+  template<typename T> struct name<T, N> { static const T coeff[]; };   \
+  template<typename T> const T name<T, N>::coeff[] =
+  /// \endcond
 
   // The scale factor A1-1 = mean value of (d/dsigma)I1 - 1
-  Math::real Geodesic::A1m1f(real eps) {
-    // Generated by Maxima on 2015-05-05 18:08:12-04:00
-#if GEOGRAPHICLIB_GEODESIC_ORDER/2 == 1
-    static const real coeff[] = {
-      // (1-eps)*A1-1, polynomial in eps2 of order 1
-      1, 0, 4,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER/2 == 2
-    static const real coeff[] = {
-      // (1-eps)*A1-1, polynomial in eps2 of order 2
-      1, 16, 0, 64,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER/2 == 3
-    static const real coeff[] = {
-      // (1-eps)*A1-1, polynomial in eps2 of order 3
-      1, 4, 64, 0, 256,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER/2 == 4
-    static const real coeff[] = {
-      // (1-eps)*A1-1, polynomial in eps2 of order 4
-      25, 64, 256, 4096, 0, 16384,
-    };
-#else
-#error "Bad value for GEOGRAPHICLIB_GEODESIC_ORDER"
-#endif
-    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(coeff) / sizeof(real) == nA1_/2 + 2,
+  // Generated by Maxima on 2015-05-05 18:08:12-04:00
+  template<typename T, int N> struct GeodesicA1m1fCoeff;
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicA1m1fCoeff, 1) {
+    // (1-eps)*A1-1, polynomial in eps2 of order 1
+    1, 0, 4,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicA1m1fCoeff, 2) {
+    // (1-eps)*A1-1, polynomial in eps2 of order 2
+    1, 16, 0, 64,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicA1m1fCoeff, 3) {
+    // (1-eps)*A1-1, polynomial in eps2 of order 3
+    1, 4, 64, 0, 256,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicA1m1fCoeff, 4) {
+    // (1-eps)*A1-1, polynomial in eps2 of order 4
+    25, 64, 256, 4096, 0, 16384,
+  };
+
+  template<typename T>
+  T GeodesicT<T>::A1m1f(real eps) {
+    typedef GeodesicA1m1fCoeff<T, nA1_/2> coeffs;
+    const real* coeff = coeffs::coeff;
+    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(coeffs::coeff) / sizeof(real) ==
+                                nA1_/2 + 2,
                                 "Coefficient array size mismatch in A1m1f");
     int m = nA1_/2;
     real t = Math::polyval(m, coeff, Math::sq(eps)) / coeff[m + 1];
@@ -986,96 +1219,92 @@ namespace geographic_lib {
   }
 
   // The coefficients C1[l] in the Fourier expansion of B1
-  void Geodesic::C1f(real eps, real c[]) {
-    // Generated by Maxima on 2015-05-05 18:08:12-04:00
-#if GEOGRAPHICLIB_GEODESIC_ORDER == 3
-    static const real coeff[] = {
-      // C1[1]/eps^1, polynomial in eps2 of order 1
-      3, -8, 16,
-      // C1[2]/eps^2, polynomial in eps2 of order 0
-      -1, 16,
-      // C1[3]/eps^3, polynomial in eps2 of order 0
-      -1, 48,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 4
-    static const real coeff[] = {
-      // C1[1]/eps^1, polynomial in eps2 of order 1
-      3, -8, 16,
-      // C1[2]/eps^2, polynomial in eps2 of order 1
-      1, -2, 32,
-      // C1[3]/eps^3, polynomial in eps2 of order 0
-      -1, 48,
-      // C1[4]/eps^4, polynomial in eps2 of order 0
-      -5, 512,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 5
-    static const real coeff[] = {
-      // C1[1]/eps^1, polynomial in eps2 of order 2
-      -1, 6, -16, 32,
-      // C1[2]/eps^2, polynomial in eps2 of order 1
-      1, -2, 32,
-      // C1[3]/eps^3, polynomial in eps2 of order 1
-      9, -16, 768,
-      // C1[4]/eps^4, polynomial in eps2 of order 0
-      -5, 512,
-      // C1[5]/eps^5, polynomial in eps2 of order 0
-      -7, 1280,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 6
-    static const real coeff[] = {
-      // C1[1]/eps^1, polynomial in eps2 of order 2
-      -1, 6, -16, 32,
-      // C1[2]/eps^2, polynomial in eps2 of order 2
-      -9, 64, -128, 2048,
-      // C1[3]/eps^3, polynomial in eps2 of order 1
-      9, -16, 768,
-      // C1[4]/eps^4, polynomial in eps2 of order 1
-      3, -5, 512,
-      // C1[5]/eps^5, polynomial in eps2 of order 0
-      -7, 1280,
-      // C1[6]/eps^6, polynomial in eps2 of order 0
-      -7, 2048,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 7
-    static const real coeff[] = {
-      // C1[1]/eps^1, polynomial in eps2 of order 3
-      19, -64, 384, -1024, 2048,
-      // C1[2]/eps^2, polynomial in eps2 of order 2
-      -9, 64, -128, 2048,
-      // C1[3]/eps^3, polynomial in eps2 of order 2
-      -9, 72, -128, 6144,
-      // C1[4]/eps^4, polynomial in eps2 of order 1
-      3, -5, 512,
-      // C1[5]/eps^5, polynomial in eps2 of order 1
-      35, -56, 10240,
-      // C1[6]/eps^6, polynomial in eps2 of order 0
-      -7, 2048,
-      // C1[7]/eps^7, polynomial in eps2 of order 0
-      -33, 14336,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 8
-    static const real coeff[] = {
-      // C1[1]/eps^1, polynomial in eps2 of order 3
-      19, -64, 384, -1024, 2048,
-      // C1[2]/eps^2, polynomial in eps2 of order 3
-      7, -18, 128, -256, 4096,
-      // C1[3]/eps^3, polynomial in eps2 of order 2
-      -9, 72, -128, 6144,
-      // C1[4]/eps^4, polynomial in eps2 of order 2
-      -11, 96, -160, 16384,
-      // C1[5]/eps^5, polynomial in eps2 of order 1
-      35, -56, 10240,
-      // C1[6]/eps^6, polynomial in eps2 of order 1
-      9, -14, 4096,
-      // C1[7]/eps^7, polynomial in eps2 of order 0
-      -33, 14336,
-      // C1[8]/eps^8, polynomial in eps2 of order 0
-      -429, 262144,
-    };
-#else
-#error "Bad value for GEOGRAPHICLIB_GEODESIC_ORDER"
-#endif
-    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(coeff) / sizeof(real) ==
+  // Generated by Maxima on 2015-05-05 18:08:12-04:00
+  template<typename T, int N> struct GeodesicC1fCoeff;
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC1fCoeff, 3) {
+    // C1[1]/eps^1, polynomial in eps2 of order 1
+    3, -8, 16,
+    // C1[2]/eps^2, polynomial in eps2 of order 0
+    -1, 16,
+    // C1[3]/eps^3, polynomial in eps2 of order 0
+    -1, 48,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC1fCoeff, 4) {
+    // C1[1]/eps^1, polynomial in eps2 of order 1
+    3, -8, 16,
+    // C1[2]/eps^2, polynomial in eps2 of order 1
+    1, -2, 32,
+    // C1[3]/eps^3, polynomial in eps2 of order 0
+    -1, 48,
+    // C1[4]/eps^4, polynomial in eps2 of order 0
+    -5, 512,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC1fCoeff, 5) {
+    // C1[1]/eps^1, polynomial in eps2 of order 2
+    -1, 6, -16, 32,
+    // C1[2]/eps^2, polynomial in eps2 of order 1
+    1, -2, 32,
+    // C1[3]/eps^3, polynomial in eps2 of order 1
+    9, -16, 768,
+    // C1[4]/eps^4, polynomial in eps2 of order 0
+    -5, 512,
+    // C1[5]/eps^5, polynomial in eps2 of order 0
+    -7, 1280,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC1fCoeff, 6) {
+    // C1[1]/eps^1, polynomial in eps2 of order 2
+    -1, 6, -16, 32,
+    // C1[2]/eps^2, polynomial in eps2 of order 2
+    -9, 64, -128, 2048,
+    // C1[3]/eps^3, polynomial in eps2 of order 1
+    9, -16, 768,
+    // C1[4]/eps^4, polynomial in eps2 of order 1
+    3, -5, 512,
+    // C1[5]/eps^5, polynomial in eps2 of order 0
+    -7, 1280,
+    // C1[6]/eps^6, polynomial in eps2 of order 0
+    -7, 2048,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC1fCoeff, 7) {
+    // C1[1]/eps^1, polynomial in eps2 of order 3
+    19, -64, 384, -1024, 2048,
+    // C1[2]/eps^2, polynomial in eps2 of order 2
+    -9, 64, -128, 2048,
+    // C1[3]/eps^3, polynomial in eps2 of order 2
+    -9, 72, -128, 6144,
+    // C1[4]/eps^4, polynomial in eps2 of order 1
+    3, -5, 512,
+    // C1[5]/eps^5, polynomial in eps2 of order 1
+    35, -56, 10240,
+    // C1[6]/eps^6, polynomial in eps2 of order 0
+    -7, 2048,
+    // C1[7]/eps^7, polynomial in eps2 of order 0
+    -33, 14336,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC1fCoeff, 8) {
+    // C1[1]/eps^1, polynomial in eps2 of order 3
+    19, -64, 384, -1024, 2048,
+    // C1[2]/eps^2, polynomial in eps2 of order 3
+    7, -18, 128, -256, 4096,
+    // C1[3]/eps^3, polynomial in eps2 of order 2
+    -9, 72, -128, 6144,
+    // C1[4]/eps^4, polynomial in eps2 of order 2
+    -11, 96, -160, 16384,
+    // C1[5]/eps^5, polynomial in eps2 of order 1
+    35, -56, 10240,
+    // C1[6]/eps^6, polynomial in eps2 of order 1
+    9, -14, 4096,
+    // C1[7]/eps^7, polynomial in eps2 of order 0
+    -33, 14336,
+    // C1[8]/eps^8, polynomial in eps2 of order 0
+    -429, 262144,
+  };
+
+  template<typename T>
+  void GeodesicT<T>::C1f(real eps, real c[]) {
+    typedef GeodesicC1fCoeff<T, nC1_> coeffs;
+    const real* coeff = coeffs::coeff;
+    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(coeffs::coeff) / sizeof(real) ==
                                 (nC1_*nC1_ + 7*nC1_ - 2*(nC1_/2)) / 4,
                                 "Coefficient array size mismatch in C1f");
     real
@@ -1088,100 +1317,96 @@ namespace geographic_lib {
       o += m + 2;
       d *= eps;
     }
-    // Post condition: o == sizeof(coeff) / sizeof(real)
+    // Post condition: o == sizeof(coeffs::coeff) / sizeof(real)
   }
 
   // The coefficients C1p[l] in the Fourier expansion of B1p
-  void Geodesic::C1pf(real eps, real c[]) {
-    // Generated by Maxima on 2015-05-05 18:08:12-04:00
-#if GEOGRAPHICLIB_GEODESIC_ORDER == 3
-    static const real coeff[] = {
-      // C1p[1]/eps^1, polynomial in eps2 of order 1
-      -9, 16, 32,
-      // C1p[2]/eps^2, polynomial in eps2 of order 0
-      5, 16,
-      // C1p[3]/eps^3, polynomial in eps2 of order 0
-      29, 96,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 4
-    static const real coeff[] = {
-      // C1p[1]/eps^1, polynomial in eps2 of order 1
-      -9, 16, 32,
-      // C1p[2]/eps^2, polynomial in eps2 of order 1
-      -37, 30, 96,
-      // C1p[3]/eps^3, polynomial in eps2 of order 0
-      29, 96,
-      // C1p[4]/eps^4, polynomial in eps2 of order 0
-      539, 1536,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 5
-    static const real coeff[] = {
-      // C1p[1]/eps^1, polynomial in eps2 of order 2
-      205, -432, 768, 1536,
-      // C1p[2]/eps^2, polynomial in eps2 of order 1
-      -37, 30, 96,
-      // C1p[3]/eps^3, polynomial in eps2 of order 1
-      -225, 116, 384,
-      // C1p[4]/eps^4, polynomial in eps2 of order 0
-      539, 1536,
-      // C1p[5]/eps^5, polynomial in eps2 of order 0
-      3467, 7680,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 6
-    static const real coeff[] = {
-      // C1p[1]/eps^1, polynomial in eps2 of order 2
-      205, -432, 768, 1536,
-      // C1p[2]/eps^2, polynomial in eps2 of order 2
-      4005, -4736, 3840, 12288,
-      // C1p[3]/eps^3, polynomial in eps2 of order 1
-      -225, 116, 384,
-      // C1p[4]/eps^4, polynomial in eps2 of order 1
-      -7173, 2695, 7680,
-      // C1p[5]/eps^5, polynomial in eps2 of order 0
-      3467, 7680,
-      // C1p[6]/eps^6, polynomial in eps2 of order 0
-      38081, 61440,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 7
-    static const real coeff[] = {
-      // C1p[1]/eps^1, polynomial in eps2 of order 3
-      -4879, 9840, -20736, 36864, 73728,
-      // C1p[2]/eps^2, polynomial in eps2 of order 2
-      4005, -4736, 3840, 12288,
-      // C1p[3]/eps^3, polynomial in eps2 of order 2
-      8703, -7200, 3712, 12288,
-      // C1p[4]/eps^4, polynomial in eps2 of order 1
-      -7173, 2695, 7680,
-      // C1p[5]/eps^5, polynomial in eps2 of order 1
-      -141115, 41604, 92160,
-      // C1p[6]/eps^6, polynomial in eps2 of order 0
-      38081, 61440,
-      // C1p[7]/eps^7, polynomial in eps2 of order 0
-      459485, 516096,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 8
-    static const real coeff[] = {
-      // C1p[1]/eps^1, polynomial in eps2 of order 3
-      -4879, 9840, -20736, 36864, 73728,
-      // C1p[2]/eps^2, polynomial in eps2 of order 3
-      -86171, 120150, -142080, 115200, 368640,
-      // C1p[3]/eps^3, polynomial in eps2 of order 2
-      8703, -7200, 3712, 12288,
-      // C1p[4]/eps^4, polynomial in eps2 of order 2
-      1082857, -688608, 258720, 737280,
-      // C1p[5]/eps^5, polynomial in eps2 of order 1
-      -141115, 41604, 92160,
-      // C1p[6]/eps^6, polynomial in eps2 of order 1
-      -2200311, 533134, 860160,
-      // C1p[7]/eps^7, polynomial in eps2 of order 0
-      459485, 516096,
-      // C1p[8]/eps^8, polynomial in eps2 of order 0
-      109167851, 82575360,
-    };
-#else
-#error "Bad value for GEOGRAPHICLIB_GEODESIC_ORDER"
-#endif
-    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(coeff) / sizeof(real) ==
+  // Generated by Maxima on 2015-05-05 18:08:12-04:00
+  template<typename T, int N> struct GeodesicC1pfCoeff;
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC1pfCoeff, 3) {
+    // C1p[1]/eps^1, polynomial in eps2 of order 1
+    -9, 16, 32,
+    // C1p[2]/eps^2, polynomial in eps2 of order 0
+    5, 16,
+    // C1p[3]/eps^3, polynomial in eps2 of order 0
+    29, 96,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC1pfCoeff, 4) {
+    // C1p[1]/eps^1, polynomial in eps2 of order 1
+    -9, 16, 32,
+    // C1p[2]/eps^2, polynomial in eps2 of order 1
+    -37, 30, 96,
+    // C1p[3]/eps^3, polynomial in eps2 of order 0
+    29, 96,
+    // C1p[4]/eps^4, polynomial in eps2 of order 0
+    539, 1536,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC1pfCoeff, 5) {
+    // C1p[1]/eps^1, polynomial in eps2 of order 2
+    205, -432, 768, 1536,
+    // C1p[2]/eps^2, polynomial in eps2 of order 1
+    -37, 30, 96,
+    // C1p[3]/eps^3, polynomial in eps2 of order 1
+    -225, 116, 384,
+    // C1p[4]/eps^4, polynomial in eps2 of order 0
+    539, 1536,
+    // C1p[5]/eps^5, polynomial in eps2 of order 0
+    3467, 7680,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC1pfCoeff, 6) {
+    // C1p[1]/eps^1, polynomial in eps2 of order 2
+    205, -432, 768, 1536,
+    // C1p[2]/eps^2, polynomial in eps2 of order 2
+    4005, -4736, 3840, 12288,
+    // C1p[3]/eps^3, polynomial in eps2 of order 1
+    -225, 116, 384,
+    // C1p[4]/eps^4, polynomial in eps2 of order 1
+    -7173, 2695, 7680,
+    // C1p[5]/eps^5, polynomial in eps2 of order 0
+    3467, 7680,
+    // C1p[6]/eps^6, polynomial in eps2 of order 0
+    38081, 61440,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC1pfCoeff, 7) {
+    // C1p[1]/eps^1, polynomial in eps2 of order 3
+    -4879, 9840, -20736, 36864, 73728,
+    // C1p[2]/eps^2, polynomial in eps2 of order 2
+    4005, -4736, 3840, 12288,
+    // C1p[3]/eps^3, polynomial in eps2 of order 2
+    8703, -7200, 3712, 12288,
+    // C1p[4]/eps^4, polynomial in eps2 of order 1
+    -7173, 2695, 7680,
+    // C1p[5]/eps^5, polynomial in eps2 of order 1
+    -141115, 41604, 92160,
+    // C1p[6]/eps^6, polynomial in eps2 of order 0
+    38081, 61440,
+    // C1p[7]/eps^7, polynomial in eps2 of order 0
+    459485, 516096,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC1pfCoeff, 8) {
+    // C1p[1]/eps^1, polynomial in eps2 of order 3
+    -4879, 9840, -20736, 36864, 73728,
+    // C1p[2]/eps^2, polynomial in eps2 of order 3
+    -86171, 120150, -142080, 115200, 368640,
+    // C1p[3]/eps^3, polynomial in eps2 of order 2
+    8703, -7200, 3712, 12288,
+    // C1p[4]/eps^4, polynomial in eps2 of order 2
+    1082857, -688608, 258720, 737280,
+    // C1p[5]/eps^5, polynomial in eps2 of order 1
+    -141115, 41604, 92160,
+    // C1p[6]/eps^6, polynomial in eps2 of order 1
+    -2200311, 533134, 860160,
+    // C1p[7]/eps^7, polynomial in eps2 of order 0
+    459485, 516096,
+    // C1p[8]/eps^8, polynomial in eps2 of order 0
+    109167851, 82575360,
+  };
+
+  template<typename T>
+  void GeodesicT<T>::C1pf(real eps, real c[]) {
+    typedef GeodesicC1pfCoeff<T, nC1p_> coeffs;
+    const real* coeff = coeffs::coeff;
+    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(coeffs::coeff) / sizeof(real) ==
                                 (nC1p_*nC1p_ + 7*nC1p_ - 2*(nC1p_/2)) / 4,
                                 "Coefficient array size mismatch in C1pf");
     real
@@ -1194,36 +1419,35 @@ namespace geographic_lib {
       o += m + 2;
       d *= eps;
     }
-    // Post condition: o == sizeof(coeff) / sizeof(real)
+    // Post condition: o == sizeof(coeffs::coeff) / sizeof(real)
   }
 
   // The scale factor A2-1 = mean value of (d/dsigma)I2 - 1
-  Math::real Geodesic::A2m1f(real eps) {
-    // Generated by Maxima on 2015-05-29 08:09:47-04:00
-#if GEOGRAPHICLIB_GEODESIC_ORDER/2 == 1
-    static const real coeff[] = {
-      // (eps+1)*A2-1, polynomial in eps2 of order 1
-      -3, 0, 4,
-    };  // count = 3
-#elif GEOGRAPHICLIB_GEODESIC_ORDER/2 == 2
-    static const real coeff[] = {
-      // (eps+1)*A2-1, polynomial in eps2 of order 2
-      -7, -48, 0, 64,
-    };  // count = 4
-#elif GEOGRAPHICLIB_GEODESIC_ORDER/2 == 3
-    static const real coeff[] = {
-      // (eps+1)*A2-1, polynomial in eps2 of order 3
-      -11, -28, -192, 0, 256,
-    };  // count = 5
-#elif GEOGRAPHICLIB_GEODESIC_ORDER/2 == 4
-    static const real coeff[] = {
-      // (eps+1)*A2-1, polynomial in eps2 of order 4
-      -375, -704, -1792, -12288, 0, 16384,
-    };  // count = 6
-#else
-#error "Bad value for GEOGRAPHICLIB_GEODESIC_ORDER"
-#endif
-    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(coeff) / sizeof(real) == nA2_/2 + 2,
+  // Generated by Maxima on 2015-05-29 08:09:47-04:00
+  template<typename T, int N> struct GeodesicA2m1fCoeff;
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicA2m1fCoeff, 1) {
+    // (eps+1)*A2-1, polynomial in eps2 of order 1
+    -3, 0, 4,
+  };  // count = 3
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicA2m1fCoeff, 2) {
+    // (eps+1)*A2-1, polynomial in eps2 of order 2
+    -7, -48, 0, 64,
+  };  // count = 4
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicA2m1fCoeff, 3) {
+    // (eps+1)*A2-1, polynomial in eps2 of order 3
+    -11, -28, -192, 0, 256,
+  };  // count = 5
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicA2m1fCoeff, 4) {
+    // (eps+1)*A2-1, polynomial in eps2 of order 4
+    -375, -704, -1792, -12288, 0, 16384,
+  };  // count = 6
+
+  template<typename T>
+  T GeodesicT<T>::A2m1f(real eps) {
+    typedef GeodesicA2m1fCoeff<T, nA2_/2> coeffs;
+    const real* coeff = coeffs::coeff;
+    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(coeffs::coeff) / sizeof(real) ==
+                                nA2_/2 + 2,
                                 "Coefficient array size mismatch in A2m1f");
     int m = nA2_/2;
     real t = Math::polyval(m, coeff, Math::sq(eps)) / coeff[m + 1];
@@ -1231,96 +1455,92 @@ namespace geographic_lib {
   }
 
   // The coefficients C2[l] in the Fourier expansion of B2
-  void Geodesic::C2f(real eps, real c[]) {
-    // Generated by Maxima on 2015-05-05 18:08:12-04:00
-#if GEOGRAPHICLIB_GEODESIC_ORDER == 3
-    static const real coeff[] = {
-      // C2[1]/eps^1, polynomial in eps2 of order 1
-      1, 8, 16,
-      // C2[2]/eps^2, polynomial in eps2 of order 0
-      3, 16,
-      // C2[3]/eps^3, polynomial in eps2 of order 0
-      5, 48,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 4
-    static const real coeff[] = {
-      // C2[1]/eps^1, polynomial in eps2 of order 1
-      1, 8, 16,
-      // C2[2]/eps^2, polynomial in eps2 of order 1
-      1, 6, 32,
-      // C2[3]/eps^3, polynomial in eps2 of order 0
-      5, 48,
-      // C2[4]/eps^4, polynomial in eps2 of order 0
-      35, 512,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 5
-    static const real coeff[] = {
-      // C2[1]/eps^1, polynomial in eps2 of order 2
-      1, 2, 16, 32,
-      // C2[2]/eps^2, polynomial in eps2 of order 1
-      1, 6, 32,
-      // C2[3]/eps^3, polynomial in eps2 of order 1
-      15, 80, 768,
-      // C2[4]/eps^4, polynomial in eps2 of order 0
-      35, 512,
-      // C2[5]/eps^5, polynomial in eps2 of order 0
-      63, 1280,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 6
-    static const real coeff[] = {
-      // C2[1]/eps^1, polynomial in eps2 of order 2
-      1, 2, 16, 32,
-      // C2[2]/eps^2, polynomial in eps2 of order 2
-      35, 64, 384, 2048,
-      // C2[3]/eps^3, polynomial in eps2 of order 1
-      15, 80, 768,
-      // C2[4]/eps^4, polynomial in eps2 of order 1
-      7, 35, 512,
-      // C2[5]/eps^5, polynomial in eps2 of order 0
-      63, 1280,
-      // C2[6]/eps^6, polynomial in eps2 of order 0
-      77, 2048,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 7
-    static const real coeff[] = {
-      // C2[1]/eps^1, polynomial in eps2 of order 3
-      41, 64, 128, 1024, 2048,
-      // C2[2]/eps^2, polynomial in eps2 of order 2
-      35, 64, 384, 2048,
-      // C2[3]/eps^3, polynomial in eps2 of order 2
-      69, 120, 640, 6144,
-      // C2[4]/eps^4, polynomial in eps2 of order 1
-      7, 35, 512,
-      // C2[5]/eps^5, polynomial in eps2 of order 1
-      105, 504, 10240,
-      // C2[6]/eps^6, polynomial in eps2 of order 0
-      77, 2048,
-      // C2[7]/eps^7, polynomial in eps2 of order 0
-      429, 14336,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 8
-    static const real coeff[] = {
-      // C2[1]/eps^1, polynomial in eps2 of order 3
-      41, 64, 128, 1024, 2048,
-      // C2[2]/eps^2, polynomial in eps2 of order 3
-      47, 70, 128, 768, 4096,
-      // C2[3]/eps^3, polynomial in eps2 of order 2
-      69, 120, 640, 6144,
-      // C2[4]/eps^4, polynomial in eps2 of order 2
-      133, 224, 1120, 16384,
-      // C2[5]/eps^5, polynomial in eps2 of order 1
-      105, 504, 10240,
-      // C2[6]/eps^6, polynomial in eps2 of order 1
-      33, 154, 4096,
-      // C2[7]/eps^7, polynomial in eps2 of order 0
-      429, 14336,
-      // C2[8]/eps^8, polynomial in eps2 of order 0
-      6435, 262144,
-    };
-#else
-#error "Bad value for GEOGRAPHICLIB_GEODESIC_ORDER"
-#endif
-    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(coeff) / sizeof(real) ==
+  // Generated by Maxima on 2015-05-05 18:08:12-04:00
+  template<typename T, int N> struct GeodesicC2fCoeff;
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC2fCoeff, 3) {
+    // C2[1]/eps^1, polynomial in eps2 of order 1
+    1, 8, 16,
+    // C2[2]/eps^2, polynomial in eps2 of order 0
+    3, 16,
+    // C2[3]/eps^3, polynomial in eps2 of order 0
+    5, 48,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC2fCoeff, 4) {
+    // C2[1]/eps^1, polynomial in eps2 of order 1
+    1, 8, 16,
+    // C2[2]/eps^2, polynomial in eps2 of order 1
+    1, 6, 32,
+    // C2[3]/eps^3, polynomial in eps2 of order 0
+    5, 48,
+    // C2[4]/eps^4, polynomial in eps2 of order 0
+    35, 512,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC2fCoeff, 5) {
+    // C2[1]/eps^1, polynomial in eps2 of order 2
+    1, 2, 16, 32,
+    // C2[2]/eps^2, polynomial in eps2 of order 1
+    1, 6, 32,
+    // C2[3]/eps^3, polynomial in eps2 of order 1
+    15, 80, 768,
+    // C2[4]/eps^4, polynomial in eps2 of order 0
+    35, 512,
+    // C2[5]/eps^5, polynomial in eps2 of order 0
+    63, 1280,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC2fCoeff, 6) {
+    // C2[1]/eps^1, polynomial in eps2 of order 2
+    1, 2, 16, 32,
+    // C2[2]/eps^2, polynomial in eps2 of order 2
+    35, 64, 384, 2048,
+    // C2[3]/eps^3, polynomial in eps2 of order 1
+    15, 80, 768,
+    // C2[4]/eps^4, polynomial in eps2 of order 1
+    7, 35, 512,
+    // C2[5]/eps^5, polynomial in eps2 of order 0
+    63, 1280,
+    // C2[6]/eps^6, polynomial in eps2 of order 0
+    77, 2048,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC2fCoeff, 7) {
+    // C2[1]/eps^1, polynomial in eps2 of order 3
+    41, 64, 128, 1024, 2048,
+    // C2[2]/eps^2, polynomial in eps2 of order 2
+    35, 64, 384, 2048,
+    // C2[3]/eps^3, polynomial in eps2 of order 2
+    69, 120, 640, 6144,
+    // C2[4]/eps^4, polynomial in eps2 of order 1
+    7, 35, 512,
+    // C2[5]/eps^5, polynomial in eps2 of order 1
+    105, 504, 10240,
+    // C2[6]/eps^6, polynomial in eps2 of order 0
+    77, 2048,
+    // C2[7]/eps^7, polynomial in eps2 of order 0
+    429, 14336,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC2fCoeff, 8) {
+    // C2[1]/eps^1, polynomial in eps2 of order 3
+    41, 64, 128, 1024, 2048,
+    // C2[2]/eps^2, polynomial in eps2 of order 3
+    47, 70, 128, 768, 4096,
+    // C2[3]/eps^3, polynomial in eps2 of order 2
+    69, 120, 640, 6144,
+    // C2[4]/eps^4, polynomial in eps2 of order 2
+    133, 224, 1120, 16384,
+    // C2[5]/eps^5, polynomial in eps2 of order 1
+    105, 504, 10240,
+    // C2[6]/eps^6, polynomial in eps2 of order 1
+    33, 154, 4096,
+    // C2[7]/eps^7, polynomial in eps2 of order 0
+    429, 14336,
+    // C2[8]/eps^8, polynomial in eps2 of order 0
+    6435, 262144,
+  };
+
+  template<typename T>
+  void GeodesicT<T>::C2f(real eps, real c[]) {
+    typedef GeodesicC2fCoeff<T, nC2_> coeffs;
+    const real* coeff = coeffs::coeff;
+    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(coeffs::coeff) / sizeof(real) ==
                                 (nC2_*nC2_ + 7*nC2_ - 2*(nC2_/2)) / 4,
                                 "Coefficient array size mismatch in C2f");
     real
@@ -1333,100 +1553,96 @@ namespace geographic_lib {
       o += m + 2;
       d *= eps;
     }
-    // Post condition: o == sizeof(coeff) / sizeof(real)
+    // Post condition: o == sizeof(coeffs::coeff) / sizeof(real)
   }
 
   // The scale factor A3 = mean value of (d/dsigma)I3
-  void Geodesic::A3coeff() {
-    // Generated by Maxima on 2015-05-05 18:08:13-04:00
-#if GEOGRAPHICLIB_GEODESIC_ORDER == 3
-    static const real coeff[] = {
-      // A3, coeff of eps^2, polynomial in n of order 0
-      -1, 4,
-      // A3, coeff of eps^1, polynomial in n of order 1
-      1, -1, 2,
-      // A3, coeff of eps^0, polynomial in n of order 0
-      1, 1,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 4
-    static const real coeff[] = {
-      // A3, coeff of eps^3, polynomial in n of order 0
-      -1, 16,
-      // A3, coeff of eps^2, polynomial in n of order 1
-      -1, -2, 8,
-      // A3, coeff of eps^1, polynomial in n of order 1
-      1, -1, 2,
-      // A3, coeff of eps^0, polynomial in n of order 0
-      1, 1,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 5
-    static const real coeff[] = {
-      // A3, coeff of eps^4, polynomial in n of order 0
-      -3, 64,
-      // A3, coeff of eps^3, polynomial in n of order 1
-      -3, -1, 16,
-      // A3, coeff of eps^2, polynomial in n of order 2
-      3, -1, -2, 8,
-      // A3, coeff of eps^1, polynomial in n of order 1
-      1, -1, 2,
-      // A3, coeff of eps^0, polynomial in n of order 0
-      1, 1,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 6
-    static const real coeff[] = {
-      // A3, coeff of eps^5, polynomial in n of order 0
-      -3, 128,
-      // A3, coeff of eps^4, polynomial in n of order 1
-      -2, -3, 64,
-      // A3, coeff of eps^3, polynomial in n of order 2
-      -1, -3, -1, 16,
-      // A3, coeff of eps^2, polynomial in n of order 2
-      3, -1, -2, 8,
-      // A3, coeff of eps^1, polynomial in n of order 1
-      1, -1, 2,
-      // A3, coeff of eps^0, polynomial in n of order 0
-      1, 1,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 7
-    static const real coeff[] = {
-      // A3, coeff of eps^6, polynomial in n of order 0
-      -5, 256,
-      // A3, coeff of eps^5, polynomial in n of order 1
-      -5, -3, 128,
-      // A3, coeff of eps^4, polynomial in n of order 2
-      -10, -2, -3, 64,
-      // A3, coeff of eps^3, polynomial in n of order 3
-      5, -1, -3, -1, 16,
-      // A3, coeff of eps^2, polynomial in n of order 2
-      3, -1, -2, 8,
-      // A3, coeff of eps^1, polynomial in n of order 1
-      1, -1, 2,
-      // A3, coeff of eps^0, polynomial in n of order 0
-      1, 1,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 8
-    static const real coeff[] = {
-      // A3, coeff of eps^7, polynomial in n of order 0
-      -25, 2048,
-      // A3, coeff of eps^6, polynomial in n of order 1
-      -15, -20, 1024,
-      // A3, coeff of eps^5, polynomial in n of order 2
-      -5, -10, -6, 256,
-      // A3, coeff of eps^4, polynomial in n of order 3
-      -5, -20, -4, -6, 128,
-      // A3, coeff of eps^3, polynomial in n of order 3
-      5, -1, -3, -1, 16,
-      // A3, coeff of eps^2, polynomial in n of order 2
-      3, -1, -2, 8,
-      // A3, coeff of eps^1, polynomial in n of order 1
-      1, -1, 2,
-      // A3, coeff of eps^0, polynomial in n of order 0
-      1, 1,
-    };
-#else
-#error "Bad value for GEOGRAPHICLIB_GEODESIC_ORDER"
-#endif
-    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(coeff) / sizeof(real) ==
+  // Generated by Maxima on 2015-05-05 18:08:13-04:00
+  template<typename T, int N> struct GeodesicA3coeffCoeff;
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicA3coeffCoeff, 3) {
+    // A3, coeff of eps^2, polynomial in n of order 0
+    -1, 4,
+    // A3, coeff of eps^1, polynomial in n of order 1
+    1, -1, 2,
+    // A3, coeff of eps^0, polynomial in n of order 0
+    1, 1,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicA3coeffCoeff, 4) {
+    // A3, coeff of eps^3, polynomial in n of order 0
+    -1, 16,
+    // A3, coeff of eps^2, polynomial in n of order 1
+    -1, -2, 8,
+    // A3, coeff of eps^1, polynomial in n of order 1
+    1, -1, 2,
+    // A3, coeff of eps^0, polynomial in n of order 0
+    1, 1,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicA3coeffCoeff, 5) {
+    // A3, coeff of eps^4, polynomial in n of order 0
+    -3, 64,
+    // A3, coeff of eps^3, polynomial in n of order 1
+    -3, -1, 16,
+    // A3, coeff of eps^2, polynomial in n of order 2
+    3, -1, -2, 8,
+    // A3, coeff of eps^1, polynomial in n of order 1
+    1, -1, 2,
+    // A3, coeff of eps^0, polynomial in n of order 0
+    1, 1,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicA3coeffCoeff, 6) {
+    // A3, coeff of eps^5, polynomial in n of order 0
+    -3, 128,
+    // A3, coeff of eps^4, polynomial in n of order 1
+    -2, -3, 64,
+    // A3, coeff of eps^3, polynomial in n of order 2
+    -1, -3, -1, 16,
+    // A3, coeff of eps^2, polynomial in n of order 2
+    3, -1, -2, 8,
+    // A3, coeff of eps^1, polynomial in n of order 1
+    1, -1, 2,
+    // A3, coeff of eps^0, polynomial in n of order 0
+    1, 1,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicA3coeffCoeff, 7) {
+    // A3, coeff of eps^6, polynomial in n of order 0
+    -5, 256,
+    // A3, coeff of eps^5, polynomial in n of order 1
+    -5, -3, 128,
+    // A3, coeff of eps^4, polynomial in n of order 2
+    -10, -2, -3, 64,
+    // A3, coeff of eps^3, polynomial in n of order 3
+    5, -1, -3, -1, 16,
+    // A3, coeff of eps^2, polynomial in n of order 2
+    3, -1, -2, 8,
+    // A3, coeff of eps^1, polynomial in n of order 1
+    1, -1, 2,
+    // A3, coeff of eps^0, polynomial in n of order 0
+    1, 1,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicA3coeffCoeff, 8) {
+    // A3, coeff of eps^7, polynomial in n of order 0
+    -25, 2048,
+    // A3, coeff of eps^6, polynomial in n of order 1
+    -15, -20, 1024,
+    // A3, coeff of eps^5, polynomial in n of order 2
+    -5, -10, -6, 256,
+    // A3, coeff of eps^4, polynomial in n of order 3
+    -5, -20, -4, -6, 128,
+    // A3, coeff of eps^3, polynomial in n of order 3
+    5, -1, -3, -1, 16,
+    // A3, coeff of eps^2, polynomial in n of order 2
+    3, -1, -2, 8,
+    // A3, coeff of eps^1, polynomial in n of order 1
+    1, -1, 2,
+    // A3, coeff of eps^0, polynomial in n of order 0
+    1, 1,
+  };
+
+  template<typename T>
+  void GeodesicT<T>::A3coeff() {
+    typedef GeodesicA3coeffCoeff<T, nA3_> coeffs;
+    const real* coeff = coeffs::coeff;
+    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(coeffs::coeff) / sizeof(real) ==
                                 (nA3_*nA3_ + 7*nA3_ - 2*(nA3_/2)) / 4,
                                 "Coefficient array size mismatch in A3f");
     int o = 0, k = 0;
@@ -1435,202 +1651,198 @@ namespace geographic_lib {
       _A3x[k++] = Math::polyval(m, coeff + o, _n) / coeff[o + m + 1];
       o += m + 2;
     }
-    // Post condition: o == sizeof(coeff) / sizeof(real) && k == nA3x_
+    // Post condition: o == sizeof(coeffs::coeff) / sizeof(real) && k == nA3x_
   }
 
   // The coefficients C3[l] in the Fourier expansion of B3
-  void Geodesic::C3coeff() {
-    // Generated by Maxima on 2015-05-05 18:08:13-04:00
-#if GEOGRAPHICLIB_GEODESIC_ORDER == 3
-    static const real coeff[] = {
-    // C3[1], coeff of eps^2, polynomial in n of order 0
-    1, 8,
-    // C3[1], coeff of eps^1, polynomial in n of order 1
-    -1, 1, 4,
-    // C3[2], coeff of eps^2, polynomial in n of order 0
-    1, 16,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 4
-    static const real coeff[] = {
-    // C3[1], coeff of eps^3, polynomial in n of order 0
-    3, 64,
-    // C3[1], coeff of eps^2, polynomial in n of order 1
-    // This is a case where a leading 0 term has been inserted to maintain the
-    // pattern in the orders of the polynomials.
-    0, 1, 8,
-    // C3[1], coeff of eps^1, polynomial in n of order 1
-    -1, 1, 4,
-    // C3[2], coeff of eps^3, polynomial in n of order 0
-    3, 64,
-    // C3[2], coeff of eps^2, polynomial in n of order 1
-    -3, 2, 32,
-    // C3[3], coeff of eps^3, polynomial in n of order 0
-    5, 192,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 5
-    static const real coeff[] = {
-    // C3[1], coeff of eps^4, polynomial in n of order 0
-    5, 128,
-    // C3[1], coeff of eps^3, polynomial in n of order 1
-    3, 3, 64,
-    // C3[1], coeff of eps^2, polynomial in n of order 2
-    -1, 0, 1, 8,
-    // C3[1], coeff of eps^1, polynomial in n of order 1
-    -1, 1, 4,
-    // C3[2], coeff of eps^4, polynomial in n of order 0
-    3, 128,
-    // C3[2], coeff of eps^3, polynomial in n of order 1
-    -2, 3, 64,
-    // C3[2], coeff of eps^2, polynomial in n of order 2
-    1, -3, 2, 32,
-    // C3[3], coeff of eps^4, polynomial in n of order 0
-    3, 128,
-    // C3[3], coeff of eps^3, polynomial in n of order 1
-    -9, 5, 192,
-    // C3[4], coeff of eps^4, polynomial in n of order 0
-    7, 512,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 6
-    static const real coeff[] = {
-    // C3[1], coeff of eps^5, polynomial in n of order 0
-    3, 128,
-    // C3[1], coeff of eps^4, polynomial in n of order 1
-    2, 5, 128,
-    // C3[1], coeff of eps^3, polynomial in n of order 2
-    -1, 3, 3, 64,
-    // C3[1], coeff of eps^2, polynomial in n of order 2
-    -1, 0, 1, 8,
-    // C3[1], coeff of eps^1, polynomial in n of order 1
-    -1, 1, 4,
-    // C3[2], coeff of eps^5, polynomial in n of order 0
-    5, 256,
-    // C3[2], coeff of eps^4, polynomial in n of order 1
-    1, 3, 128,
-    // C3[2], coeff of eps^3, polynomial in n of order 2
-    -3, -2, 3, 64,
-    // C3[2], coeff of eps^2, polynomial in n of order 2
-    1, -3, 2, 32,
-    // C3[3], coeff of eps^5, polynomial in n of order 0
-    7, 512,
-    // C3[3], coeff of eps^4, polynomial in n of order 1
-    -10, 9, 384,
-    // C3[3], coeff of eps^3, polynomial in n of order 2
-    5, -9, 5, 192,
-    // C3[4], coeff of eps^5, polynomial in n of order 0
-    7, 512,
-    // C3[4], coeff of eps^4, polynomial in n of order 1
-    -14, 7, 512,
-    // C3[5], coeff of eps^5, polynomial in n of order 0
-    21, 2560,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 7
-    static const real coeff[] = {
-    // C3[1], coeff of eps^6, polynomial in n of order 0
-    21, 1024,
-    // C3[1], coeff of eps^5, polynomial in n of order 1
-    11, 12, 512,
-    // C3[1], coeff of eps^4, polynomial in n of order 2
-    2, 2, 5, 128,
-    // C3[1], coeff of eps^3, polynomial in n of order 3
-    -5, -1, 3, 3, 64,
-    // C3[1], coeff of eps^2, polynomial in n of order 2
-    -1, 0, 1, 8,
-    // C3[1], coeff of eps^1, polynomial in n of order 1
-    -1, 1, 4,
-    // C3[2], coeff of eps^6, polynomial in n of order 0
-    27, 2048,
-    // C3[2], coeff of eps^5, polynomial in n of order 1
-    1, 5, 256,
-    // C3[2], coeff of eps^4, polynomial in n of order 2
-    -9, 2, 6, 256,
-    // C3[2], coeff of eps^3, polynomial in n of order 3
-    2, -3, -2, 3, 64,
-    // C3[2], coeff of eps^2, polynomial in n of order 2
-    1, -3, 2, 32,
-    // C3[3], coeff of eps^6, polynomial in n of order 0
-    3, 256,
-    // C3[3], coeff of eps^5, polynomial in n of order 1
-    -4, 21, 1536,
-    // C3[3], coeff of eps^4, polynomial in n of order 2
-    -6, -10, 9, 384,
-    // C3[3], coeff of eps^3, polynomial in n of order 3
-    -1, 5, -9, 5, 192,
-    // C3[4], coeff of eps^6, polynomial in n of order 0
-    9, 1024,
-    // C3[4], coeff of eps^5, polynomial in n of order 1
-    -10, 7, 512,
-    // C3[4], coeff of eps^4, polynomial in n of order 2
-    10, -14, 7, 512,
-    // C3[5], coeff of eps^6, polynomial in n of order 0
-    9, 1024,
-    // C3[5], coeff of eps^5, polynomial in n of order 1
-    -45, 21, 2560,
-    // C3[6], coeff of eps^6, polynomial in n of order 0
-    11, 2048,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 8
-    static const real coeff[] = {
-    // C3[1], coeff of eps^7, polynomial in n of order 0
-    243, 16384,
-    // C3[1], coeff of eps^6, polynomial in n of order 1
-    10, 21, 1024,
-    // C3[1], coeff of eps^5, polynomial in n of order 2
-    3, 11, 12, 512,
-    // C3[1], coeff of eps^4, polynomial in n of order 3
-    -2, 2, 2, 5, 128,
-    // C3[1], coeff of eps^3, polynomial in n of order 3
-    -5, -1, 3, 3, 64,
-    // C3[1], coeff of eps^2, polynomial in n of order 2
-    -1, 0, 1, 8,
-    // C3[1], coeff of eps^1, polynomial in n of order 1
-    -1, 1, 4,
-    // C3[2], coeff of eps^7, polynomial in n of order 0
-    187, 16384,
-    // C3[2], coeff of eps^6, polynomial in n of order 1
-    69, 108, 8192,
-    // C3[2], coeff of eps^5, polynomial in n of order 2
-    -2, 1, 5, 256,
-    // C3[2], coeff of eps^4, polynomial in n of order 3
-    -6, -9, 2, 6, 256,
-    // C3[2], coeff of eps^3, polynomial in n of order 3
-    2, -3, -2, 3, 64,
-    // C3[2], coeff of eps^2, polynomial in n of order 2
-    1, -3, 2, 32,
-    // C3[3], coeff of eps^7, polynomial in n of order 0
-    139, 16384,
-    // C3[3], coeff of eps^6, polynomial in n of order 1
-    -1, 12, 1024,
-    // C3[3], coeff of eps^5, polynomial in n of order 2
-    -77, -8, 42, 3072,
-    // C3[3], coeff of eps^4, polynomial in n of order 3
-    10, -6, -10, 9, 384,
-    // C3[3], coeff of eps^3, polynomial in n of order 3
-    -1, 5, -9, 5, 192,
-    // C3[4], coeff of eps^7, polynomial in n of order 0
-    127, 16384,
-    // C3[4], coeff of eps^6, polynomial in n of order 1
-    -43, 72, 8192,
-    // C3[4], coeff of eps^5, polynomial in n of order 2
-    -7, -40, 28, 2048,
-    // C3[4], coeff of eps^4, polynomial in n of order 3
-    -7, 20, -28, 14, 1024,
-    // C3[5], coeff of eps^7, polynomial in n of order 0
-    99, 16384,
-    // C3[5], coeff of eps^6, polynomial in n of order 1
-    -15, 9, 1024,
-    // C3[5], coeff of eps^5, polynomial in n of order 2
-    75, -90, 42, 5120,
-    // C3[6], coeff of eps^7, polynomial in n of order 0
-    99, 16384,
-    // C3[6], coeff of eps^6, polynomial in n of order 1
-    -99, 44, 8192,
-    // C3[7], coeff of eps^7, polynomial in n of order 0
-    429, 114688,
-    };
-#else
-#error "Bad value for GEOGRAPHICLIB_GEODESIC_ORDER"
-#endif
-    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(coeff) / sizeof(real) ==
+  // Generated by Maxima on 2015-05-05 18:08:13-04:00
+  template<typename T, int N> struct GeodesicC3coeffCoeff;
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC3coeffCoeff, 3) {
+  // C3[1], coeff of eps^2, polynomial in n of order 0
+  1, 8,
+  // C3[1], coeff of eps^1, polynomial in n of order 1
+  -1, 1, 4,
+  // C3[2], coeff of eps^2, polynomial in n of order 0
+  1, 16,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC3coeffCoeff, 4) {
+  // C3[1], coeff of eps^3, polynomial in n of order 0
+  3, 64,
+  // C3[1], coeff of eps^2, polynomial in n of order 1
+  // This is a case where a leading 0 term has been inserted to maintain the
+  // pattern in the orders of the polynomials.
+  0, 1, 8,
+  // C3[1], coeff of eps^1, polynomial in n of order 1
+  -1, 1, 4,
+  // C3[2], coeff of eps^3, polynomial in n of order 0
+  3, 64,
+  // C3[2], coeff of eps^2, polynomial in n of order 1
+  -3, 2, 32,
+  // C3[3], coeff of eps^3, polynomial in n of order 0
+  5, 192,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC3coeffCoeff, 5) {
+  // C3[1], coeff of eps^4, polynomial in n of order 0
+  5, 128,
+  // C3[1], coeff of eps^3, polynomial in n of order 1
+  3, 3, 64,
+  // C3[1], coeff of eps^2, polynomial in n of order 2
+  -1, 0, 1, 8,
+  // C3[1], coeff of eps^1, polynomial in n of order 1
+  -1, 1, 4,
+  // C3[2], coeff of eps^4, polynomial in n of order 0
+  3, 128,
+  // C3[2], coeff of eps^3, polynomial in n of order 1
+  -2, 3, 64,
+  // C3[2], coeff of eps^2, polynomial in n of order 2
+  1, -3, 2, 32,
+  // C3[3], coeff of eps^4, polynomial in n of order 0
+  3, 128,
+  // C3[3], coeff of eps^3, polynomial in n of order 1
+  -9, 5, 192,
+  // C3[4], coeff of eps^4, polynomial in n of order 0
+  7, 512,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC3coeffCoeff, 6) {
+  // C3[1], coeff of eps^5, polynomial in n of order 0
+  3, 128,
+  // C3[1], coeff of eps^4, polynomial in n of order 1
+  2, 5, 128,
+  // C3[1], coeff of eps^3, polynomial in n of order 2
+  -1, 3, 3, 64,
+  // C3[1], coeff of eps^2, polynomial in n of order 2
+  -1, 0, 1, 8,
+  // C3[1], coeff of eps^1, polynomial in n of order 1
+  -1, 1, 4,
+  // C3[2], coeff of eps^5, polynomial in n of order 0
+  5, 256,
+  // C3[2], coeff of eps^4, polynomial in n of order 1
+  1, 3, 128,
+  // C3[2], coeff of eps^3, polynomial in n of order 2
+  -3, -2, 3, 64,
+  // C3[2], coeff of eps^2, polynomial in n of order 2
+  1, -3, 2, 32,
+  // C3[3], coeff of eps^5, polynomial in n of order 0
+  7, 512,
+  // C3[3], coeff of eps^4, polynomial in n of order 1
+  -10, 9, 384,
+  // C3[3], coeff of eps^3, polynomial in n of order 2
+  5, -9, 5, 192,
+  // C3[4], coeff of eps^5, polynomial in n of order 0
+  7, 512,
+  // C3[4], coeff of eps^4, polynomial in n of order 1
+  -14, 7, 512,
+  // C3[5], coeff of eps^5, polynomial in n of order 0
+  21, 2560,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC3coeffCoeff, 7) {
+  // C3[1], coeff of eps^6, polynomial in n of order 0
+  21, 1024,
+  // C3[1], coeff of eps^5, polynomial in n of order 1
+  11, 12, 512,
+  // C3[1], coeff of eps^4, polynomial in n of order 2
+  2, 2, 5, 128,
+  // C3[1], coeff of eps^3, polynomial in n of order 3
+  -5, -1, 3, 3, 64,
+  // C3[1], coeff of eps^2, polynomial in n of order 2
+  -1, 0, 1, 8,
+  // C3[1], coeff of eps^1, polynomial in n of order 1
+  -1, 1, 4,
+  // C3[2], coeff of eps^6, polynomial in n of order 0
+  27, 2048,
+  // C3[2], coeff of eps^5, polynomial in n of order 1
+  1, 5, 256,
+  // C3[2], coeff of eps^4, polynomial in n of order 2
+  -9, 2, 6, 256,
+  // C3[2], coeff of eps^3, polynomial in n of order 3
+  2, -3, -2, 3, 64,
+  // C3[2], coeff of eps^2, polynomial in n of order 2
+  1, -3, 2, 32,
+  // C3[3], coeff of eps^6, polynomial in n of order 0
+  3, 256,
+  // C3[3], coeff of eps^5, polynomial in n of order 1
+  -4, 21, 1536,
+  // C3[3], coeff of eps^4, polynomial in n of order 2
+  -6, -10, 9, 384,
+  // C3[3], coeff of eps^3, polynomial in n of order 3
+  -1, 5, -9, 5, 192,
+  // C3[4], coeff of eps^6, polynomial in n of order 0
+  9, 1024,
+  // C3[4], coeff of eps^5, polynomial in n of order 1
+  -10, 7, 512,
+  // C3[4], coeff of eps^4, polynomial in n of order 2
+  10, -14, 7, 512,
+  // C3[5], coeff of eps^6, polynomial in n of order 0
+  9, 1024,
+  // C3[5], coeff of eps^5, polynomial in n of order 1
+  -45, 21, 2560,
+  // C3[6], coeff of eps^6, polynomial in n of order 0
+  11, 2048,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC3coeffCoeff, 8) {
+  // C3[1], coeff of eps^7, polynomial in n of order 0
+  243, 16384,
+  // C3[1], coeff of eps^6, polynomial in n of order 1
+  10, 21, 1024,
+  // C3[1], coeff of eps^5, polynomial in n of order 2
+  3, 11, 12, 512,
+  // C3[1], coeff of eps^4, polynomial in n of order 3
+  -2, 2, 2, 5, 128,
+  // C3[1], coeff of eps^3, polynomial in n of order 3
+  -5, -1, 3, 3, 64,
+  // C3[1], coeff of eps^2, polynomial in n of order 2
+  -1, 0, 1, 8,
+  // C3[1], coeff of eps^1, polynomial in n of order 1
+  -1, 1, 4,
+  // C3[2], coeff of eps^7, polynomial in n of order 0
+  187, 16384,
+  // C3[2], coeff of eps^6, polynomial in n of order 1
+  69, 108, 8192,
+  // C3[2], coeff of eps^5, polynomial in n of order 2
+  -2, 1, 5, 256,
+  // C3[2], coeff of eps^4, polynomial in n of order 3
+  -6, -9, 2, 6, 256,
+  // C3[2], coeff of eps^3, polynomial in n of order 3
+  2, -3, -2, 3, 64,
+  // C3[2], coeff of eps^2, polynomial in n of order 2
+  1, -3, 2, 32,
+  // C3[3], coeff of eps^7, polynomial in n of order 0
+  139, 16384,
+  // C3[3], coeff of eps^6, polynomial in n of order 1
+  -1, 12, 1024,
+  // C3[3], coeff of eps^5, polynomial in n of order 2
+  -77, -8, 42, 3072,
+  // C3[3], coeff of eps^4, polynomial in n of order 3
+  10, -6, -10, 9, 384,
+  // C3[3], coeff of eps^3, polynomial in n of order 3
+  -1, 5, -9, 5, 192,
+  // C3[4], coeff of eps^7, polynomial in n of order 0
+  127, 16384,
+  // C3[4], coeff of eps^6, polynomial in n of order 1
+  -43, 72, 8192,
+  // C3[4], coeff of eps^5, polynomial in n of order 2
+  -7, -40, 28, 2048,
+  // C3[4], coeff of eps^4, polynomial in n of order 3
+  -7, 20, -28, 14, 1024,
+  // C3[5], coeff of eps^7, polynomial in n of order 0
+  99, 16384,
+  // C3[5], coeff of eps^6, polynomial in n of order 1
+  -15, 9, 1024,
+  // C3[5], coeff of eps^5, polynomial in n of order 2
+  75, -90, 42, 5120,
+  // C3[6], coeff of eps^7, polynomial in n of order 0
+  99, 16384,
+  // C3[6], coeff of eps^6, polynomial in n of order 1
+  -99, 44, 8192,
+  // C3[7], coeff of eps^7, polynomial in n of order 0
+  429, 114688,
+  };
+
+  template<typename T>
+  void GeodesicT<T>::C3coeff() {
+    typedef GeodesicC3coeffCoeff<T, nC3_> coeffs;
+    const real* coeff = coeffs::coeff;
+    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(coeffs::coeff) / sizeof(real) ==
                                 ((nC3_-1)*(nC3_*nC3_ + 7*nC3_ - 2*(nC3_/2)))/8,
                                 "Coefficient array size mismatch in C3coeff");
     int o = 0, k = 0;
@@ -1641,265 +1853,261 @@ namespace geographic_lib {
         o += m + 2;
       }
     }
-    // Post condition: o == sizeof(coeff) / sizeof(real) && k == nC3x_
+    // Post condition: o == sizeof(coeffs::coeff) / sizeof(real) && k == nC3x_
   }
 
-  void Geodesic::C4coeff() {
-    // Generated by Maxima on 2015-05-05 18:08:13-04:00
-#if GEOGRAPHICLIB_GEODESIC_ORDER == 3
-    static const real coeff[] = {
-      // C4[0], coeff of eps^2, polynomial in n of order 0
-      -2, 105,
-      // C4[0], coeff of eps^1, polynomial in n of order 1
-      16, -7, 35,
-      // C4[0], coeff of eps^0, polynomial in n of order 2
-      8, -28, 70, 105,
-      // C4[1], coeff of eps^2, polynomial in n of order 0
-      -2, 105,
-      // C4[1], coeff of eps^1, polynomial in n of order 1
-      -16, 7, 315,
-      // C4[2], coeff of eps^2, polynomial in n of order 0
-      4, 525,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 4
-    static const real coeff[] = {
-      // C4[0], coeff of eps^3, polynomial in n of order 0
-      11, 315,
-      // C4[0], coeff of eps^2, polynomial in n of order 1
-      -32, -6, 315,
-      // C4[0], coeff of eps^1, polynomial in n of order 2
-      -32, 48, -21, 105,
-      // C4[0], coeff of eps^0, polynomial in n of order 3
-      4, 24, -84, 210, 315,
-      // C4[1], coeff of eps^3, polynomial in n of order 0
-      -1, 105,
-      // C4[1], coeff of eps^2, polynomial in n of order 1
-      64, -18, 945,
-      // C4[1], coeff of eps^1, polynomial in n of order 2
-      32, -48, 21, 945,
-      // C4[2], coeff of eps^3, polynomial in n of order 0
-      -8, 1575,
-      // C4[2], coeff of eps^2, polynomial in n of order 1
-      -32, 12, 1575,
-      // C4[3], coeff of eps^3, polynomial in n of order 0
-      8, 2205,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 5
-    static const real coeff[] = {
-      // C4[0], coeff of eps^4, polynomial in n of order 0
-      4, 1155,
-      // C4[0], coeff of eps^3, polynomial in n of order 1
-      -368, 121, 3465,
-      // C4[0], coeff of eps^2, polynomial in n of order 2
-      1088, -352, -66, 3465,
-      // C4[0], coeff of eps^1, polynomial in n of order 3
-      48, -352, 528, -231, 1155,
-      // C4[0], coeff of eps^0, polynomial in n of order 4
-      16, 44, 264, -924, 2310, 3465,
-      // C4[1], coeff of eps^4, polynomial in n of order 0
-      4, 1155,
-      // C4[1], coeff of eps^3, polynomial in n of order 1
-      80, -99, 10395,
-      // C4[1], coeff of eps^2, polynomial in n of order 2
-      -896, 704, -198, 10395,
-      // C4[1], coeff of eps^1, polynomial in n of order 3
-      -48, 352, -528, 231, 10395,
-      // C4[2], coeff of eps^4, polynomial in n of order 0
-      -8, 1925,
-      // C4[2], coeff of eps^3, polynomial in n of order 1
-      384, -88, 17325,
-      // C4[2], coeff of eps^2, polynomial in n of order 2
-      320, -352, 132, 17325,
-      // C4[3], coeff of eps^4, polynomial in n of order 0
-      -16, 8085,
-      // C4[3], coeff of eps^3, polynomial in n of order 1
-      -256, 88, 24255,
-      // C4[4], coeff of eps^4, polynomial in n of order 0
-      64, 31185,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 6
-    static const real coeff[] = {
-      // C4[0], coeff of eps^5, polynomial in n of order 0
-      97, 15015,
-      // C4[0], coeff of eps^4, polynomial in n of order 1
-      1088, 156, 45045,
-      // C4[0], coeff of eps^3, polynomial in n of order 2
-      -224, -4784, 1573, 45045,
-      // C4[0], coeff of eps^2, polynomial in n of order 3
-      -10656, 14144, -4576, -858, 45045,
-      // C4[0], coeff of eps^1, polynomial in n of order 4
-      64, 624, -4576, 6864, -3003, 15015,
-      // C4[0], coeff of eps^0, polynomial in n of order 5
-      100, 208, 572, 3432, -12012, 30030, 45045,
-      // C4[1], coeff of eps^5, polynomial in n of order 0
-      1, 9009,
-      // C4[1], coeff of eps^4, polynomial in n of order 1
-      -2944, 468, 135135,
-      // C4[1], coeff of eps^3, polynomial in n of order 2
-      5792, 1040, -1287, 135135,
-      // C4[1], coeff of eps^2, polynomial in n of order 3
-      5952, -11648, 9152, -2574, 135135,
-      // C4[1], coeff of eps^1, polynomial in n of order 4
-      -64, -624, 4576, -6864, 3003, 135135,
-      // C4[2], coeff of eps^5, polynomial in n of order 0
-      8, 10725,
-      // C4[2], coeff of eps^4, polynomial in n of order 1
-      1856, -936, 225225,
-      // C4[2], coeff of eps^3, polynomial in n of order 2
-      -8448, 4992, -1144, 225225,
-      // C4[2], coeff of eps^2, polynomial in n of order 3
-      -1440, 4160, -4576, 1716, 225225,
-      // C4[3], coeff of eps^5, polynomial in n of order 0
-      -136, 63063,
-      // C4[3], coeff of eps^4, polynomial in n of order 1
-      1024, -208, 105105,
-      // C4[3], coeff of eps^3, polynomial in n of order 2
-      3584, -3328, 1144, 315315,
-      // C4[4], coeff of eps^5, polynomial in n of order 0
-      -128, 135135,
-      // C4[4], coeff of eps^4, polynomial in n of order 1
-      -2560, 832, 405405,
-      // C4[5], coeff of eps^5, polynomial in n of order 0
-      128, 99099,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 7
-    static const real coeff[] = {
-      // C4[0], coeff of eps^6, polynomial in n of order 0
-      10, 9009,
-      // C4[0], coeff of eps^5, polynomial in n of order 1
-      -464, 291, 45045,
-      // C4[0], coeff of eps^4, polynomial in n of order 2
-      -4480, 1088, 156, 45045,
-      // C4[0], coeff of eps^3, polynomial in n of order 3
-      10736, -224, -4784, 1573, 45045,
-      // C4[0], coeff of eps^2, polynomial in n of order 4
-      1664, -10656, 14144, -4576, -858, 45045,
-      // C4[0], coeff of eps^1, polynomial in n of order 5
-      16, 64, 624, -4576, 6864, -3003, 15015,
-      // C4[0], coeff of eps^0, polynomial in n of order 6
-      56, 100, 208, 572, 3432, -12012, 30030, 45045,
-      // C4[1], coeff of eps^6, polynomial in n of order 0
-      10, 9009,
-      // C4[1], coeff of eps^5, polynomial in n of order 1
-      112, 15, 135135,
-      // C4[1], coeff of eps^4, polynomial in n of order 2
-      3840, -2944, 468, 135135,
-      // C4[1], coeff of eps^3, polynomial in n of order 3
-      -10704, 5792, 1040, -1287, 135135,
-      // C4[1], coeff of eps^2, polynomial in n of order 4
-      -768, 5952, -11648, 9152, -2574, 135135,
-      // C4[1], coeff of eps^1, polynomial in n of order 5
-      -16, -64, -624, 4576, -6864, 3003, 135135,
-      // C4[2], coeff of eps^6, polynomial in n of order 0
-      -4, 25025,
-      // C4[2], coeff of eps^5, polynomial in n of order 1
-      -1664, 168, 225225,
-      // C4[2], coeff of eps^4, polynomial in n of order 2
-      1664, 1856, -936, 225225,
-      // C4[2], coeff of eps^3, polynomial in n of order 3
-      6784, -8448, 4992, -1144, 225225,
-      // C4[2], coeff of eps^2, polynomial in n of order 4
-      128, -1440, 4160, -4576, 1716, 225225,
-      // C4[3], coeff of eps^6, polynomial in n of order 0
-      64, 315315,
-      // C4[3], coeff of eps^5, polynomial in n of order 1
-      1792, -680, 315315,
-      // C4[3], coeff of eps^4, polynomial in n of order 2
-      -2048, 1024, -208, 105105,
-      // C4[3], coeff of eps^3, polynomial in n of order 3
-      -1792, 3584, -3328, 1144, 315315,
-      // C4[4], coeff of eps^6, polynomial in n of order 0
-      -512, 405405,
-      // C4[4], coeff of eps^5, polynomial in n of order 1
-      2048, -384, 405405,
-      // C4[4], coeff of eps^4, polynomial in n of order 2
-      3072, -2560, 832, 405405,
-      // C4[5], coeff of eps^6, polynomial in n of order 0
-      -256, 495495,
-      // C4[5], coeff of eps^5, polynomial in n of order 1
-      -2048, 640, 495495,
-      // C4[6], coeff of eps^6, polynomial in n of order 0
-      512, 585585,
-    };
-#elif GEOGRAPHICLIB_GEODESIC_ORDER == 8
-    static const real coeff[] = {
-      // C4[0], coeff of eps^7, polynomial in n of order 0
-      193, 85085,
-      // C4[0], coeff of eps^6, polynomial in n of order 1
-      4192, 850, 765765,
-      // C4[0], coeff of eps^5, polynomial in n of order 2
-      20960, -7888, 4947, 765765,
-      // C4[0], coeff of eps^4, polynomial in n of order 3
-      12480, -76160, 18496, 2652, 765765,
-      // C4[0], coeff of eps^3, polynomial in n of order 4
-      -154048, 182512, -3808, -81328, 26741, 765765,
-      // C4[0], coeff of eps^2, polynomial in n of order 5
-      3232, 28288, -181152, 240448, -77792, -14586, 765765,
-      // C4[0], coeff of eps^1, polynomial in n of order 6
-      96, 272, 1088, 10608, -77792, 116688, -51051, 255255,
-      // C4[0], coeff of eps^0, polynomial in n of order 7
-      588, 952, 1700, 3536, 9724, 58344, -204204, 510510, 765765,
-      // C4[1], coeff of eps^7, polynomial in n of order 0
-      349, 2297295,
-      // C4[1], coeff of eps^6, polynomial in n of order 1
-      -1472, 510, 459459,
-      // C4[1], coeff of eps^5, polynomial in n of order 2
-      -39840, 1904, 255, 2297295,
-      // C4[1], coeff of eps^4, polynomial in n of order 3
-      52608, 65280, -50048, 7956, 2297295,
-      // C4[1], coeff of eps^3, polynomial in n of order 4
-      103744, -181968, 98464, 17680, -21879, 2297295,
-      // C4[1], coeff of eps^2, polynomial in n of order 5
-      -1344, -13056, 101184, -198016, 155584, -43758, 2297295,
-      // C4[1], coeff of eps^1, polynomial in n of order 6
-      -96, -272, -1088, -10608, 77792, -116688, 51051, 2297295,
-      // C4[2], coeff of eps^7, polynomial in n of order 0
-      464, 1276275,
-      // C4[2], coeff of eps^6, polynomial in n of order 1
-      -928, -612, 3828825,
-      // C4[2], coeff of eps^5, polynomial in n of order 2
-      64256, -28288, 2856, 3828825,
-      // C4[2], coeff of eps^4, polynomial in n of order 3
-      -126528, 28288, 31552, -15912, 3828825,
-      // C4[2], coeff of eps^3, polynomial in n of order 4
-      -41472, 115328, -143616, 84864, -19448, 3828825,
-      // C4[2], coeff of eps^2, polynomial in n of order 5
-      160, 2176, -24480, 70720, -77792, 29172, 3828825,
-      // C4[3], coeff of eps^7, polynomial in n of order 0
-      -16, 97461,
-      // C4[3], coeff of eps^6, polynomial in n of order 1
-      -16384, 1088, 5360355,
-      // C4[3], coeff of eps^5, polynomial in n of order 2
-      -2560, 30464, -11560, 5360355,
-      // C4[3], coeff of eps^4, polynomial in n of order 3
-      35840, -34816, 17408, -3536, 1786785,
-      // C4[3], coeff of eps^3, polynomial in n of order 4
-      7168, -30464, 60928, -56576, 19448, 5360355,
-      // C4[4], coeff of eps^7, polynomial in n of order 0
-      128, 2297295,
-      // C4[4], coeff of eps^6, polynomial in n of order 1
-      26624, -8704, 6891885,
-      // C4[4], coeff of eps^5, polynomial in n of order 2
-      -77824, 34816, -6528, 6891885,
-      // C4[4], coeff of eps^4, polynomial in n of order 3
-      -32256, 52224, -43520, 14144, 6891885,
-      // C4[5], coeff of eps^7, polynomial in n of order 0
-      -6784, 8423415,
-      // C4[5], coeff of eps^6, polynomial in n of order 1
-      24576, -4352, 8423415,
-      // C4[5], coeff of eps^5, polynomial in n of order 2
-      45056, -34816, 10880, 8423415,
-      // C4[6], coeff of eps^7, polynomial in n of order 0
-      -1024, 3318315,
-      // C4[6], coeff of eps^6, polynomial in n of order 1
-      -28672, 8704, 9954945,
-      // C4[7], coeff of eps^7, polynomial in n of order 0
-      1024, 1640925,
-    };
-#else
-#error "Bad value for GEOGRAPHICLIB_GEODESIC_ORDER"
-#endif
-    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(coeff) / sizeof(real) ==
+  // Generated by Maxima on 2015-05-05 18:08:13-04:00
+  template<typename T, int N> struct GeodesicC4coeffCoeff;
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC4coeffCoeff, 3) {
+    // C4[0], coeff of eps^2, polynomial in n of order 0
+    -2, 105,
+    // C4[0], coeff of eps^1, polynomial in n of order 1
+    16, -7, 35,
+    // C4[0], coeff of eps^0, polynomial in n of order 2
+    8, -28, 70, 105,
+    // C4[1], coeff of eps^2, polynomial in n of order 0
+    -2, 105,
+    // C4[1], coeff of eps^1, polynomial in n of order 1
+    -16, 7, 315,
+    // C4[2], coeff of eps^2, polynomial in n of order 0
+    4, 525,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC4coeffCoeff, 4) {
+    // C4[0], coeff of eps^3, polynomial in n of order 0
+    11, 315,
+    // C4[0], coeff of eps^2, polynomial in n of order 1
+    -32, -6, 315,
+    // C4[0], coeff of eps^1, polynomial in n of order 2
+    -32, 48, -21, 105,
+    // C4[0], coeff of eps^0, polynomial in n of order 3
+    4, 24, -84, 210, 315,
+    // C4[1], coeff of eps^3, polynomial in n of order 0
+    -1, 105,
+    // C4[1], coeff of eps^2, polynomial in n of order 1
+    64, -18, 945,
+    // C4[1], coeff of eps^1, polynomial in n of order 2
+    32, -48, 21, 945,
+    // C4[2], coeff of eps^3, polynomial in n of order 0
+    -8, 1575,
+    // C4[2], coeff of eps^2, polynomial in n of order 1
+    -32, 12, 1575,
+    // C4[3], coeff of eps^3, polynomial in n of order 0
+    8, 2205,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC4coeffCoeff, 5) {
+    // C4[0], coeff of eps^4, polynomial in n of order 0
+    4, 1155,
+    // C4[0], coeff of eps^3, polynomial in n of order 1
+    -368, 121, 3465,
+    // C4[0], coeff of eps^2, polynomial in n of order 2
+    1088, -352, -66, 3465,
+    // C4[0], coeff of eps^1, polynomial in n of order 3
+    48, -352, 528, -231, 1155,
+    // C4[0], coeff of eps^0, polynomial in n of order 4
+    16, 44, 264, -924, 2310, 3465,
+    // C4[1], coeff of eps^4, polynomial in n of order 0
+    4, 1155,
+    // C4[1], coeff of eps^3, polynomial in n of order 1
+    80, -99, 10395,
+    // C4[1], coeff of eps^2, polynomial in n of order 2
+    -896, 704, -198, 10395,
+    // C4[1], coeff of eps^1, polynomial in n of order 3
+    -48, 352, -528, 231, 10395,
+    // C4[2], coeff of eps^4, polynomial in n of order 0
+    -8, 1925,
+    // C4[2], coeff of eps^3, polynomial in n of order 1
+    384, -88, 17325,
+    // C4[2], coeff of eps^2, polynomial in n of order 2
+    320, -352, 132, 17325,
+    // C4[3], coeff of eps^4, polynomial in n of order 0
+    -16, 8085,
+    // C4[3], coeff of eps^3, polynomial in n of order 1
+    -256, 88, 24255,
+    // C4[4], coeff of eps^4, polynomial in n of order 0
+    64, 31185,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC4coeffCoeff, 6) {
+    // C4[0], coeff of eps^5, polynomial in n of order 0
+    97, 15015,
+    // C4[0], coeff of eps^4, polynomial in n of order 1
+    1088, 156, 45045,
+    // C4[0], coeff of eps^3, polynomial in n of order 2
+    -224, -4784, 1573, 45045,
+    // C4[0], coeff of eps^2, polynomial in n of order 3
+    -10656, 14144, -4576, -858, 45045,
+    // C4[0], coeff of eps^1, polynomial in n of order 4
+    64, 624, -4576, 6864, -3003, 15015,
+    // C4[0], coeff of eps^0, polynomial in n of order 5
+    100, 208, 572, 3432, -12012, 30030, 45045,
+    // C4[1], coeff of eps^5, polynomial in n of order 0
+    1, 9009,
+    // C4[1], coeff of eps^4, polynomial in n of order 1
+    -2944, 468, 135135,
+    // C4[1], coeff of eps^3, polynomial in n of order 2
+    5792, 1040, -1287, 135135,
+    // C4[1], coeff of eps^2, polynomial in n of order 3
+    5952, -11648, 9152, -2574, 135135,
+    // C4[1], coeff of eps^1, polynomial in n of order 4
+    -64, -624, 4576, -6864, 3003, 135135,
+    // C4[2], coeff of eps^5, polynomial in n of order 0
+    8, 10725,
+    // C4[2], coeff of eps^4, polynomial in n of order 1
+    1856, -936, 225225,
+    // C4[2], coeff of eps^3, polynomial in n of order 2
+    -8448, 4992, -1144, 225225,
+    // C4[2], coeff of eps^2, polynomial in n of order 3
+    -1440, 4160, -4576, 1716, 225225,
+    // C4[3], coeff of eps^5, polynomial in n of order 0
+    -136, 63063,
+    // C4[3], coeff of eps^4, polynomial in n of order 1
+    1024, -208, 105105,
+    // C4[3], coeff of eps^3, polynomial in n of order 2
+    3584, -3328, 1144, 315315,
+    // C4[4], coeff of eps^5, polynomial in n of order 0
+    -128, 135135,
+    // C4[4], coeff of eps^4, polynomial in n of order 1
+    -2560, 832, 405405,
+    // C4[5], coeff of eps^5, polynomial in n of order 0
+    128, 99099,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC4coeffCoeff, 7) {
+    // C4[0], coeff of eps^6, polynomial in n of order 0
+    10, 9009,
+    // C4[0], coeff of eps^5, polynomial in n of order 1
+    -464, 291, 45045,
+    // C4[0], coeff of eps^4, polynomial in n of order 2
+    -4480, 1088, 156, 45045,
+    // C4[0], coeff of eps^3, polynomial in n of order 3
+    10736, -224, -4784, 1573, 45045,
+    // C4[0], coeff of eps^2, polynomial in n of order 4
+    1664, -10656, 14144, -4576, -858, 45045,
+    // C4[0], coeff of eps^1, polynomial in n of order 5
+    16, 64, 624, -4576, 6864, -3003, 15015,
+    // C4[0], coeff of eps^0, polynomial in n of order 6
+    56, 100, 208, 572, 3432, -12012, 30030, 45045,
+    // C4[1], coeff of eps^6, polynomial in n of order 0
+    10, 9009,
+    // C4[1], coeff of eps^5, polynomial in n of order 1
+    112, 15, 135135,
+    // C4[1], coeff of eps^4, polynomial in n of order 2
+    3840, -2944, 468, 135135,
+    // C4[1], coeff of eps^3, polynomial in n of order 3
+    -10704, 5792, 1040, -1287, 135135,
+    // C4[1], coeff of eps^2, polynomial in n of order 4
+    -768, 5952, -11648, 9152, -2574, 135135,
+    // C4[1], coeff of eps^1, polynomial in n of order 5
+    -16, -64, -624, 4576, -6864, 3003, 135135,
+    // C4[2], coeff of eps^6, polynomial in n of order 0
+    -4, 25025,
+    // C4[2], coeff of eps^5, polynomial in n of order 1
+    -1664, 168, 225225,
+    // C4[2], coeff of eps^4, polynomial in n of order 2
+    1664, 1856, -936, 225225,
+    // C4[2], coeff of eps^3, polynomial in n of order 3
+    6784, -8448, 4992, -1144, 225225,
+    // C4[2], coeff of eps^2, polynomial in n of order 4
+    128, -1440, 4160, -4576, 1716, 225225,
+    // C4[3], coeff of eps^6, polynomial in n of order 0
+    64, 315315,
+    // C4[3], coeff of eps^5, polynomial in n of order 1
+    1792, -680, 315315,
+    // C4[3], coeff of eps^4, polynomial in n of order 2
+    -2048, 1024, -208, 105105,
+    // C4[3], coeff of eps^3, polynomial in n of order 3
+    -1792, 3584, -3328, 1144, 315315,
+    // C4[4], coeff of eps^6, polynomial in n of order 0
+    -512, 405405,
+    // C4[4], coeff of eps^5, polynomial in n of order 1
+    2048, -384, 405405,
+    // C4[4], coeff of eps^4, polynomial in n of order 2
+    3072, -2560, 832, 405405,
+    // C4[5], coeff of eps^6, polynomial in n of order 0
+    -256, 495495,
+    // C4[5], coeff of eps^5, polynomial in n of order 1
+    -2048, 640, 495495,
+    // C4[6], coeff of eps^6, polynomial in n of order 0
+    512, 585585,
+  };
+  GEOGRAPHICLIB_GEODESIC_COEFF(GeodesicC4coeffCoeff, 8) {
+    // C4[0], coeff of eps^7, polynomial in n of order 0
+    193, 85085,
+    // C4[0], coeff of eps^6, polynomial in n of order 1
+    4192, 850, 765765,
+    // C4[0], coeff of eps^5, polynomial in n of order 2
+    20960, -7888, 4947, 765765,
+    // C4[0], coeff of eps^4, polynomial in n of order 3
+    12480, -76160, 18496, 2652, 765765,
+    // C4[0], coeff of eps^3, polynomial in n of order 4
+    -154048, 182512, -3808, -81328, 26741, 765765,
+    // C4[0], coeff of eps^2, polynomial in n of order 5
+    3232, 28288, -181152, 240448, -77792, -14586, 765765,
+    // C4[0], coeff of eps^1, polynomial in n of order 6
+    96, 272, 1088, 10608, -77792, 116688, -51051, 255255,
+    // C4[0], coeff of eps^0, polynomial in n of order 7
+    588, 952, 1700, 3536, 9724, 58344, -204204, 510510, 765765,
+    // C4[1], coeff of eps^7, polynomial in n of order 0
+    349, 2297295,
+    // C4[1], coeff of eps^6, polynomial in n of order 1
+    -1472, 510, 459459,
+    // C4[1], coeff of eps^5, polynomial in n of order 2
+    -39840, 1904, 255, 2297295,
+    // C4[1], coeff of eps^4, polynomial in n of order 3
+    52608, 65280, -50048, 7956, 2297295,
+    // C4[1], coeff of eps^3, polynomial in n of order 4
+    103744, -181968, 98464, 17680, -21879, 2297295,
+    // C4[1], coeff of eps^2, polynomial in n of order 5
+    -1344, -13056, 101184, -198016, 155584, -43758, 2297295,
+    // C4[1], coeff of eps^1, polynomial in n of order 6
+    -96, -272, -1088, -10608, 77792, -116688, 51051, 2297295,
+    // C4[2], coeff of eps^7, polynomial in n of order 0
+    464, 1276275,
+    // C4[2], coeff of eps^6, polynomial in n of order 1
+    -928, -612, 3828825,
+    // C4[2], coeff of eps^5, polynomial in n of order 2
+    64256, -28288, 2856, 3828825,
+    // C4[2], coeff of eps^4, polynomial in n of order 3
+    -126528, 28288, 31552, -15912, 3828825,
+    // C4[2], coeff of eps^3, polynomial in n of order 4
+    -41472, 115328, -143616, 84864, -19448, 3828825,
+    // C4[2], coeff of eps^2, polynomial in n of order 5
+    160, 2176, -24480, 70720, -77792, 29172, 3828825,
+    // C4[3], coeff of eps^7, polynomial in n of order 0
+    -16, 97461,
+    // C4[3], coeff of eps^6, polynomial in n of order 1
+    -16384, 1088, 5360355,
+    // C4[3], coeff of eps^5, polynomial in n of order 2
+    -2560, 30464, -11560, 5360355,
+    // C4[3], coeff of eps^4, polynomial in n of order 3
+    35840, -34816, 17408, -3536, 1786785,
+    // C4[3], coeff of eps^3, polynomial in n of order 4
+    7168, -30464, 60928, -56576, 19448, 5360355,
+    // C4[4], coeff of eps^7, polynomial in n of order 0
+    128, 2297295,
+    // C4[4], coeff of eps^6, polynomial in n of order 1
+    26624, -8704, 6891885,
+    // C4[4], coeff of eps^5, polynomial in n of order 2
+    -77824, 34816, -6528, 6891885,
+    // C4[4], coeff of eps^4, polynomial in n of order 3
+    -32256, 52224, -43520, 14144, 6891885,
+    // C4[5], coeff of eps^7, polynomial in n of order 0
+    -6784, 8423415,
+    // C4[5], coeff of eps^6, polynomial in n of order 1
+    24576, -4352, 8423415,
+    // C4[5], coeff of eps^5, polynomial in n of order 2
+    45056, -34816, 10880, 8423415,
+    // C4[6], coeff of eps^7, polynomial in n of order 0
+    -1024, 3318315,
+    // C4[6], coeff of eps^6, polynomial in n of order 1
+    -28672, 8704, 9954945,
+    // C4[7], coeff of eps^7, polynomial in n of order 0
+    1024, 1640925,
+  };
+
+  template<typename T>
+  void GeodesicT<T>::C4coeff() {
+    typedef GeodesicC4coeffCoeff<T, nC4_> coeffs;
+    const real* coeff = coeffs::coeff;
+    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(coeffs::coeff) / sizeof(real) ==
                                 (nC4_ * (nC4_ + 1) * (nC4_ + 5)) / 6,
                                 "Coefficient array size mismatch in C4coeff");
     int o = 0, k = 0;
@@ -1910,7 +2118,15 @@ namespace geographic_lib {
         o += m + 2;
       }
     }
-    // Post condition: o == sizeof(coeff) / sizeof(real) && k == nC4x_
+    // Post condition: o == sizeof(coeffs::coeff) / sizeof(real) && k == nC4x_
   }
 
+  /// \cond SKIP
+  // Instantiate
+  template class GEOGRAPHICLIB_EXPORT GeodesicT<Math::real>;
+#if GEOGRAPHICLIB_PRECISION != 1
+  template class GEOGRAPHICLIB_EXPORT GeodesicT<float>;
+#endif
+  /// \endcond
+
 } // namespace geographic_lib
@@ -0,0 +1,101 @@
+/**
+ * \file GeodesicDistanceMatrix.cpp
+ * \brief Implementation for geographic_lib::GeodesicDistanceMatrixT class
+ *
+ * Copyright (c) 2026 the geographic_lib authors and licensed under the
+ * MIT/X11 License.  This file is not part of the upstream GeographicLib
+ * distribution; see https://geographiclib.sourceforge.io/ for that.
+ **********************************************************************/
+
+#include <vector>
+#include <geographic_lib/GeodesicDistanceMatrix.hpp>
+
+#if defined(_OPENMP)
+#  include <omp.h>
+#endif
+
+namespace geographic_lib {
+
+  using namespace std;
+
+  template<typename T>
+  GeodesicDistanceMatrixT<T>::GeodesicDistanceMatrixT
+  (const GeodesicT<T>& earth, int rowtile, int coltile)
+    : _earth(earth)
+    , _rowtile(rowtile)
+    , _coltile(coltile)
+  {
+    if (!(_rowtile > 0 && _coltile > 0))
+      throw GeographicErr("Tile dimensions are not positive");
+  }
+
+  template<typename T>
+  int GeodesicDistanceMatrixT<T>::MaxThreads() {
+#if defined(_OPENMP)
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+  }
+
+  template<typename T>
+  void GeodesicDistanceMatrixT<T>::Compute(size_t n, const real lat1[],
+                                           const real lon1[],
+                                           size_t m, const real lat2[],
+                                           const real lon2[],
+                                           unsigned outmask, real s12[],
+                                           real azi1[], real azi2[]) const {
+    outmask &= GeodesicT<T>::OUT_MASK;
+    if (n == 0 || m == 0) return;
+    bool
+      distp = (outmask & DISTANCE) != 0,
+      azip = (outmask & AZIMUTH) != 0;
+    // The prepared points for the rows and the columns
+    vector<GeodesicPointT<T> > p1(n), p2(m);
+    // OpenMP 2.0 (Visual Studio) requires a signed loop index
+    long ln = long(n), lm = long(m);
+#if defined(_OPENMP)
+#  pragma omp parallel for
+#endif
+    for (long i = 0; i < ln; ++i)
+      p1[i] = GeodesicPointT<T>(_earth, lat1[i], lon1[i]);
+#if defined(_OPENMP)
+#  pragma omp parallel for
+#endif
+    for (long j = 0; j < lm; ++j)
+      p2[j] = GeodesicPointT<T>(_earth, lat2[j], lon2[j]);
+    long
+      nr = (ln + _rowtile - 1) / _rowtile,
+      nc = (lm + _coltile - 1) / _coltile,
+      ntiles = nr * nc;
+    // Tiles are taken in row-major order; the dynamic schedule balances the
+    // load when the cost of the inverse problem varies across the matrix.
+#if defined(_OPENMP)
+#  pragma omp parallel for schedule(dynamic)
+#endif
+    for (long k = 0; k < ntiles; ++k) {
+      long
+        i0 = (k / nc) * _rowtile, i1 = min(i0 + _rowtile, ln),
+        j0 = (k % nc) * _coltile, j1 = min(j0 + _coltile, lm);
+      for (long i = i0; i < i1; ++i) {
+        size_t ij = size_t(i) * m + size_t(j0);
+        for (long j = j0; j < j1; ++j, ++ij) {
+          real s12x, azi1x, azi2x, t;
+          _earth.GenInverse(p1[i], p2[j], outmask,
+                            s12x, azi1x, azi2x, t, t, t, t);
+          if (distp) s12[ij] = s12x;
+          if (azip) { azi1[ij] = azi1x; azi2[ij] = azi2x; }
+        }
+      }
+    }
+  }
+
+  /// \cond SKIP
+  // Instantiate
+  template class GEOGRAPHICLIB_EXPORT GeodesicDistanceMatrixT<Math::real>;
+#if GEOGRAPHICLIB_PRECISION != 1
+  template class GEOGRAPHICLIB_EXPORT GeodesicDistanceMatrixT<float>;
+#endif
+  /// \endcond
+
+} // namespace geographic_lib
@@ -28,6 +28,11 @@
 
 #include <geographic_lib/GeodesicExact.hpp>
 #include <geographic_lib/GeodesicLineExact.hpp>
+#if GEOGRAPHICLIB_CXX11_THREADS
+#  include <map>
+#  include <mutex>
+#  include <vector>
+#endif
 
 #if defined(_MSC_VER)
 // Squelch warnings about potentially uninitialized local variables and
@@ -39,6 +44,24 @@ namespace geographic_lib {
 
   using namespace std;
 
+#if GEOGRAPHICLIB_CXX11_THREADS
+  namespace {
+    typedef Math::real real;
+    // The coefficients only depend on f.  The number of digits is included in
+    // the key because this can be changed at run time with mpreal.
+    typedef pair<int, real> C4key;
+    struct C4cache {
+      mutex lock;
+      map<C4key, vector<real> > entries;
+    };
+    C4cache& c4cache() {
+      static C4cache cache;
+      return cache;
+    }
+    const size_t maxc4cache_ = 64;
+  }
+#endif
+
   GeodesicExact::GeodesicExact(real a, real f)
     : maxit2_(maxit1_ + Math::digits() + 10)
       // Underflow guard.  We require
@@ -87,7 +110,73 @@ namespace geographic_lib {
       throw GeographicErr("Equatorial radius is not positive");
     if (!(Math::isfinite(_b) && _b > 0))
       throw GeographicErr("Polar semi-axis is not positive");
-    C4coeff();
+#if !GEOGRAPHICLIB_CXX11_THREADS
+    // Without a mutex to protect _c4, compute the coefficients now
+    C4coeff(_c4.c);
+    _c4.set();
+#endif
+  }
+
+  void GeodesicExact::C4init() const {
+#if GEOGRAPHICLIB_CXX11_THREADS
+    if (_c4.ready())
+      return;
+    C4cache& cache = c4cache();
+    C4key key(Math::digits(), _f);
+    {
+      lock_guard<mutex> guard(cache.lock);
+      if (_c4.ready())
+        return;
+      map<C4key, vector<real> >::const_iterator it = cache.entries.find(key);
+      if (it != cache.entries.end()) {
+        copy(it->second.begin(), it->second.end(), _c4.c);
+        _c4.set();
+        return;
+      }
+    }
+    // Compute the coefficients without holding the lock.  Other threads may
+    // be doing the same for this flattening (or this object); the results
+    // are the same, and only the first is stored.
+    vector<real> c(nC4x_);
+    C4coeff(&c[0]);
+    lock_guard<mutex> guard(cache.lock);
+    if (cache.entries.size() < maxc4cache_)
+      cache.entries.insert(make_pair(key, c));
+    if (!_c4.ready()) {
+      copy(c.begin(), c.end(), _c4.c);
+      _c4.set();
+    }
+#endif
+  }
+
+  void GeodesicExact::Prewarm(real a, real f) {
+    GeodesicExact(a, f).C4init();
+  }
+
+  void GeodesicExact::ClearCache() {
+#if GEOGRAPHICLIB_CXX11_THREADS
+    C4cache& cache = c4cache();
+    lock_guard<mutex> guard(cache.lock);
+    cache.entries.clear();
+#endif
+  }
+
+  size_t GeodesicExact::CacheSize() {
+#if GEOGRAPHICLIB_CXX11_THREADS
+    C4cache& cache = c4cache();
+    lock_guard<mutex> guard(cache.lock);
+    return cache.entries.size();
+#else
+    return 0;
+#endif
+  }
+
+  size_t GeodesicExact::MaxCacheSize() {
+#if GEOGRAPHICLIB_CXX11_THREADS
+    return maxc4cache_;
+#else
+    return 0;
+#endif
   }
 
   const GeodesicExact& GeodesicExact::WGS84() {
@@ -96,6 +185,31 @@ namespace geographic_lib {
     return wgs84;
   }
 
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+  GeodesicStatistics& GeodesicExact::Stats() {
+#  if GEOGRAPHICLIB_CXX11_THREADS
+    static thread_local GeodesicStatistics stats;
+#  else
+    static GeodesicStatistics stats;
+#  endif
+    return stats;
+  }
+#endif
+
+  GeodesicStatistics GeodesicExact::Statistics() {
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+    return Stats();
+#else
+    return GeodesicStatistics();
+#endif
+  }
+
+  void GeodesicExact::ResetStatistics() {
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+    Stats().Reset();
+#endif
+  }
+
   Math::real GeodesicExact::CosSeries(real sinx, real cosx,
                                       const real c[], int n) {
     // Evaluate
@@ -169,6 +283,9 @@ namespace geographic_lib {
                                        real& salp2, real& calp2,
                                        real& m12, real& M12, real& M21,
                                        real& S12) const {
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+    ++Stats().inverse;
+#endif
     // Compute longitude difference (AngDiff does this carefully).  Result is
     // in [-180, 180] but -180 is only for west-going geodesics.  180 is for
     // east-going and meridional geodesics.
@@ -347,6 +464,9 @@ namespace geographic_lib {
         unsigned numit = 0;
         // Bracketing range
         real salp1a = tiny_, calp1a = 1, salp1b = tiny_, calp1b = -1;
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+        bool bisected = false;
+#endif
         for (bool tripn = false, tripb = false;
              numit < maxit2_ || GEOGRAPHICLIB_PANIC;
              ++numit) {
@@ -408,6 +528,9 @@ namespace geographic_lib {
           // 90deg:
           // the WGS84 test set: mean = 5.21, sd = 3.93, max = 24
           // WGS84 and random input: mean = 4.74, sd = 0.99
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+          bisected = true;
+#endif
           salp1 = (salp1a + salp1b)/2;
           calp1 = (calp1a + calp1b)/2;
           Math::norm(salp1, calp1);
@@ -415,6 +538,9 @@ namespace geographic_lib {
           tripb = (abs(salp1a - salp1) + (calp1a - calp1) < tolb_ ||
                    abs(salp1 - salp1b) + (calp1 - calp1b) < tolb_);
         }
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+        Stats().AddIterative(numit, maxit1_, maxit2_, bisected);
+#endif
         {
           real dummy;
           Lengths(E, sig12, ssig1, csig1, dn1, ssig2, csig2, dn2,
@@ -596,6 +722,9 @@ namespace geographic_lib {
 
   Math::real GeodesicExact::Astroid(real x, real y) {
     // Solve k^4+2*k^3-(x^2+y^2-1)*k^2-2*y^2*k-y^2 = 0 for positive root k.
+#if GEOGRAPHICLIB_GEODESIC_STATISTICS
+    ++Stats().astroid;
+#endif
     // This solution is adapted from Geocentric::Reverse.
     real k;
     real
@@ -915,11 +1044,12 @@ namespace geographic_lib {
   void GeodesicExact::C4f(real eps, real c[]) const {
     // Evaluate C4 coeffs
     // Elements c[0] thru c[nC4_ - 1] are set
+    C4init();
     real mult = 1;
     int o = 0;
     for (int l = 0; l < nC4_; ++l) { // l is index of C4[l]
       int m = nC4_ - l - 1;          // order of polynomial in eps
-      c[l] = mult * Math::polyval(m, _C4x + o, eps);
+      c[l] = mult * Math::polyval(m, _c4.c + o, eps);
       o += m + 1;
       mult *= eps;
     }
@@ -33,7 +33,7 @@ namespace geographic_lib {
   // so the cast is not needed; 21708121824 = 678378807*2^5 and 678378807 >=
   // 2^24 so the cast is needed.
 
-  void GeodesicExact::C4coeff() {
+  void GeodesicExact::C4coeff(real c[]) const {
     // Generated by Maxima on 2017-05-27 10:17:57-04:00
 #if GEOGRAPHICLIB_GEODESICEXACT_ORDER == 24
     static const real coeff[] = {
@@ -7294,7 +7294,7 @@ namespace geographic_lib {
     for (int l = 0; l < nC4_; ++l) {        // l is index of C4[l]
       for (int j = nC4_ - 1; j >= l; --j) { // coeff of eps^j
         int m = nC4_ - j - 1;               // order of polynomial in n
-        _C4x[k++] = Math::polyval(m, coeff + o, _n) / coeff[o + m + 1];
+        c[k++] = Math::polyval(m, coeff + o, _n) / coeff[o + m + 1];
         o += m + 2;
       }
     }
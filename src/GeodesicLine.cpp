@@ -32,10 +32,22 @@ namespace geographic_lib {
 
   using namespace std;
 
-  void GeodesicLine::LineInit(const Geodesic& g,
-                              real lat1, real lon1,
-                              real azi1, real salp1, real calp1,
-                              unsigned caps) {
+  template<typename T>
+  void GeodesicLineT<T>::LineInit(const GeodesicT<T>& g,
+                                  real lat1, real lon1,
+                                  real azi1, real salp1, real calp1,
+                                  unsigned caps) {
+    real sbet1, cbet1, dn1;
+    g.ReducedLatitude(Math::LatFix(lat1), sbet1, cbet1, dn1);
+    LineInit(g, lat1, lon1, azi1, salp1, calp1, sbet1, cbet1, dn1, caps);
+  }
+
+  template<typename T>
+  void GeodesicLineT<T>::LineInit(const GeodesicT<T>& g,
+                                  real lat1, real lon1,
+                                  real azi1, real salp1, real calp1,
+                                  real sbet1, real cbet1, real dn1,
+                                  unsigned caps) {
     tiny_ = g.tiny_;
     _lat1 = Math::LatFix(lat1);
     _lon1 = lon1;
@@ -49,12 +61,7 @@ namespace geographic_lib {
     _f1 = g._f1;
     // Always allow latitude and azimuth and unrolling of longitude
     _caps = caps | LATITUDE | AZIMUTH | LONG_UNROLL;
-
-    real cbet1, sbet1;
-    Math::sincosd(Math::AngRound(_lat1), sbet1, cbet1); sbet1 *= _f1;
-    // Ensure cbet1 = +epsilon at poles
-    Math::norm(sbet1, cbet1); cbet1 = max(tiny_, cbet1);
-    _dn1 = sqrt(1 + g._ep2 * Math::sq(sbet1));
+    _dn1 = dn1;
 
     // Evaluate alp0 from sin(alp1) * cos(bet1) = sin(alp0),
     _salp0 = _salp1 * cbet1; // alp0 in [0, pi/2 - |bet1|]
@@ -79,9 +86,9 @@ namespace geographic_lib {
     real eps = _k2 / (2 * (1 + sqrt(1 + _k2)) + _k2);
 
     if (_caps & CAP_C1) {
-      _A1m1 = Geodesic::A1m1f(eps);
-      Geodesic::C1f(eps, _C1a);
-      _B11 = Geodesic::SinCosSeries(true, _ssig1, _csig1, _C1a, nC1_);
+      _A1m1 = GeodesicT<T>::A1m1f(eps);
+      GeodesicT<T>::C1f(eps, _C1a);
+      _B11 = GeodesicT<T>::SinCosSeries(true, _ssig1, _csig1, _C1a, nC1_);
       real s = sin(_B11), c = cos(_B11);
       // tau1 = sig1 + B11
       _stau1 = _ssig1 * c + _csig1 * s;
@@ -91,33 +98,34 @@ namespace geographic_lib {
     }
 
     if (_caps & CAP_C1p)
-      Geodesic::C1pf(eps, _C1pa);
+      GeodesicT<T>::C1pf(eps, _C1pa);
 
     if (_caps & CAP_C2) {
-      _A2m1 = Geodesic::A2m1f(eps);
-      Geodesic::C2f(eps, _C2a);
-      _B21 = Geodesic::SinCosSeries(true, _ssig1, _csig1, _C2a, nC2_);
+      _A2m1 = GeodesicT<T>::A2m1f(eps);
+      GeodesicT<T>::C2f(eps, _C2a);
+      _B21 = GeodesicT<T>::SinCosSeries(true, _ssig1, _csig1, _C2a, nC2_);
     }
 
     if (_caps & CAP_C3) {
       g.C3f(eps, _C3a);
       _A3c = -_f * _salp0 * g.A3f(eps);
-      _B31 = Geodesic::SinCosSeries(true, _ssig1, _csig1, _C3a, nC3_-1);
+      _B31 = GeodesicT<T>::SinCosSeries(true, _ssig1, _csig1, _C3a, nC3_-1);
     }
 
     if (_caps & CAP_C4) {
       g.C4f(eps, _C4a);
       // Multiplier = a^2 * e^2 * cos(alpha0) * sin(alpha0)
       _A4 = Math::sq(_a) * _calp0 * _salp0 * g._e2;
-      _B41 = Geodesic::SinCosSeries(false, _ssig1, _csig1, _C4a, nC4_);
+      _B41 = GeodesicT<T>::SinCosSeries(false, _ssig1, _csig1, _C4a, nC4_);
     }
 
-    _a13 = _s13 = Math::NaN();
+    _a13 = _s13 = Math::NaN<real>();
   }
 
-  GeodesicLine::GeodesicLine(const Geodesic& g,
-                             real lat1, real lon1, real azi1,
-                             unsigned caps) {
+  template<typename T>
+  GeodesicLineT<T>::GeodesicLineT(const GeodesicT<T>& g,
+                                  real lat1, real lon1, real azi1,
+                                  unsigned caps) {
     azi1 = Math::AngNormalize(azi1);
     real salp1, calp1;
     // Guard against underflow in salp0.  Also -0 is converted to +0.
@@ -125,30 +133,32 @@ namespace geographic_lib {
     LineInit(g, lat1, lon1, azi1, salp1, calp1, caps);
   }
 
-  GeodesicLine::GeodesicLine(const Geodesic& g,
-                             real lat1, real lon1,
-                             real azi1, real salp1, real calp1,
-                             unsigned caps, bool arcmode, real s13_a13) {
+  template<typename T>
+  GeodesicLineT<T>::GeodesicLineT(const GeodesicT<T>& g,
+                                  real lat1, real lon1,
+                                  real azi1, real salp1, real calp1,
+                                  unsigned caps, bool arcmode, real s13_a13) {
     LineInit(g, lat1, lon1, azi1, salp1, calp1, caps);
     GenSetDistance(arcmode, s13_a13);
   }
 
-  Math::real GeodesicLine::GenPosition(bool arcmode, real s12_a12,
-                                       unsigned outmask,
-                                       real& lat2, real& lon2, real& azi2,
-                                       real& s12, real& m12,
-                                       real& M12, real& M21,
-                                       real& S12) const {
+  template<typename T>
+  T GeodesicLineT<T>::GenPosition(bool arcmode, real s12_a12,
+                                  unsigned outmask,
+                                  real& lat2, real& lon2, real& azi2,
+                                  real& s12, real& m12,
+                                  real& M12, real& M21,
+                                  real& S12) const {
     outmask &= _caps & OUT_MASK;
     if (!( Init() && (arcmode || (_caps & (OUT_MASK & DISTANCE_IN))) ))
       // Uninitialized or impossible distance calculation requested
-      return Math::NaN();
+      return Math::NaN<real>();
 
     // Avoid warning about uninitialized B12.
     real sig12, ssig12, csig12, B12 = 0, AB1 = 0;
     if (arcmode) {
       // Interpret s12_a12 as spherical arc length
-      sig12 = s12_a12 * Math::degree();
+      sig12 = s12_a12 * Math::degree<real>();
       Math::sincosd(s12_a12, ssig12, csig12);
     } else {
       // Interpret s12_a12 as distance
@@ -157,10 +167,10 @@ namespace geographic_lib {
         s = sin(tau12),
         c = cos(tau12);
       // tau2 = tau1 + tau12
-      B12 = - Geodesic::SinCosSeries(true,
-                                     _stau1 * c + _ctau1 * s,
-                                     _ctau1 * c - _stau1 * s,
-                                     _C1pa, nC1p_);
+      B12 = - GeodesicT<T>::SinCosSeries(true,
+                                         _stau1 * c + _ctau1 * s,
+                                         _ctau1 * c - _stau1 * s,
+                                         _C1pa, nC1p_);
       sig12 = tau12 - (B12 - _B11);
       ssig12 = sin(sig12); csig12 = cos(sig12);
       if (abs(_f) > 0.01) {
@@ -189,7 +199,7 @@ namespace geographic_lib {
         real
           ssig2 = _ssig1 * csig12 + _csig1 * ssig12,
           csig2 = _csig1 * csig12 - _ssig1 * ssig12;
-        B12 = Geodesic::SinCosSeries(true, ssig2, csig2, _C1a, nC1_);
+        B12 = GeodesicT<T>::SinCosSeries(true, ssig2, csig2, _C1a, nC1_);
         real serr = (1 + _A1m1) * (sig12 + (B12 - _B11)) - s12_a12 / _b;
         sig12 = sig12 - serr / sqrt(1 + _k2 * Math::sq(ssig2));
         ssig12 = sin(sig12); csig12 = cos(sig12);
@@ -204,7 +214,7 @@ namespace geographic_lib {
     real dn2 = sqrt(1 + _k2 * Math::sq(ssig2));
     if (outmask & (DISTANCE | REDUCEDLENGTH | GEODESICSCALE)) {
       if (arcmode || abs(_f) > 0.01)
-        B12 = Geodesic::SinCosSeries(true, ssig2, csig2, _C1a, nC1_);
+        B12 = GeodesicT<T>::SinCosSeries(true, ssig2, csig2, _C1a, nC1_);
       AB1 = (1 + _A1m1) * (B12 - _B11);
     }
     // sin(bet2) = cos(alp0) * sin(sig2)
@@ -232,9 +242,10 @@ namespace geographic_lib {
         : atan2(somg2 * _comg1 - comg2 * _somg1,
                 comg2 * _comg1 + somg2 * _somg1);
       real lam12 = omg12 + _A3c *
-        ( sig12 + (Geodesic::SinCosSeries(true, ssig2, csig2, _C3a, nC3_-1)
+        ( sig12 + (GeodesicT<T>::SinCosSeries(true, ssig2, csig2,
+                                              _C3a, nC3_-1)
                    - _B31));
-      real lon12 = lam12 / Math::degree();
+      real lon12 = lam12 / Math::degree<real>();
       lon2 = outmask & LONG_UNROLL ? _lon1 + lon12 :
         Math::AngNormalize(Math::AngNormalize(_lon1) +
                            Math::AngNormalize(lon12));
@@ -248,7 +259,7 @@ namespace geographic_lib {
 
     if (outmask & (REDUCEDLENGTH | GEODESICSCALE)) {
       real
-        B22 = Geodesic::SinCosSeries(true, ssig2, csig2, _C2a, nC2_),
+        B22 = GeodesicT<T>::SinCosSeries(true, ssig2, csig2, _C2a, nC2_),
         AB2 = (1 + _A2m1) * (B22 - _B21),
         J12 = (_A1m1 - _A2m1) * sig12 + (AB1 - AB2);
       if (outmask & REDUCEDLENGTH)
@@ -265,7 +276,7 @@ namespace geographic_lib {
 
     if (outmask & AREA) {
       real
-        B42 = Geodesic::SinCosSeries(false, ssig2, csig2, _C4a, nC4_);
+        B42 = GeodesicT<T>::SinCosSeries(false, ssig2, csig2, _C4a, nC4_);
       real salp12, calp12;
       if (_calp0 == 0 || _salp0 == 0) {
         // alp12 = alp2 - alp1, used in atan2 so no need to normalize
@@ -295,10 +306,241 @@ namespace geographic_lib {
       S12 = _c2 * atan2(salp12, calp12) + _A4 * (B42 - _B41);
     }
 
-    return arcmode ? s12_a12 : sig12 / Math::degree();
+    return arcmode ? s12_a12 : sig12 / Math::degree<real>();
+  }
+
+  template<typename T>
+  void GeodesicLineT<T>::SinCosSeriesBlock(bool sinp,
+                                           const real sinx[],
+                                           const real cosx[],
+                                           const real c[], int n, real y[]) {
+    // This is GeodesicT<T>::SinCosSeries with the loops over the lanes_
+    // angles innermost, so that they can be vectorized.  The arithmetic is
+    // the same, so that the results are identical.
+    c += (n + sinp);            // Point to one beyond last element
+    real ar[lanes_], y0[lanes_], y1[lanes_], c0 = n & 1 ? *--c : 0;
+    for (int l = 0; l < lanes_; ++l) {
+      ar[l] = 2 * (cosx[l] - sinx[l]) * (cosx[l] + sinx[l]);
+      y0[l] = c0; y1[l] = 0;
+    }
+    n /= 2;
+    while (n--) {
+      real c1 = *--c;
+      real c2 = *--c;
+      for (int l = 0; l < lanes_; ++l) {
+        y1[l] = ar[l] * y0[l] - y1[l] + c1;
+        y0[l] = ar[l] * y1[l] - y0[l] + c2;
+      }
+    }
+    if (sinp)
+      for (int l = 0; l < lanes_; ++l)
+        y[l] = 2 * sinx[l] * cosx[l] * y0[l];
+    else
+      for (int l = 0; l < lanes_; ++l)
+        y[l] = cosx[l] * (y0[l] - y1[l]);
+  }
+
+  template<typename T>
+  void GeodesicLineT<T>::GenPositions(bool arcmode, size_t n,
+                                      const real s12_a12[], unsigned outmask,
+                                      real a12[],
+                                      real lat2[], real lon2[], real azi2[],
+                                      real s12[], real m12[],
+                                      real M12[], real M21[],
+                                      real S12[]) const {
+    if (!( Init() && (arcmode || (_caps & (OUT_MASK & DISTANCE_IN))) )) {
+      // Uninitialized or impossible distance calculation requested
+      if (a12)
+        for (size_t i = 0; i < n; ++i) a12[i] = Math::NaN<real>();
+      return;
+    }
+    outmask &= _caps & OUT_MASK;
+    // This follows GenPosition with the quantities for a block of lanes_
+    // points held in arrays.  The tests on outmask (and on the other
+    // quantities which are independent of the point) are made once per step
+    // instead of once per point.  The arithmetic is otherwise the same, so
+    // that the results are identical.
+    bool
+      latp = (outmask & LATITUDE) != 0,
+      lonp = (outmask & LONGITUDE) != 0,
+      azip = (outmask & AZIMUTH) != 0,
+      distp = (outmask & DISTANCE) != 0,
+      redlp = (outmask & REDUCEDLENGTH) != 0,
+      scalep = (outmask & GEODESICSCALE) != 0,
+      areap = (outmask & AREA) != 0,
+      unroll = (outmask & LONG_UNROLL) != 0,
+      B12p = (outmask & (DISTANCE | REDUCEDLENGTH | GEODESICSCALE)) != 0,
+      // Correct sig12 with 1 Newton iteration (see GenPosition)
+      newton = abs(_f) > real(0.01);
+    real
+      E = Math::copysign(real(1), _salp0), // east-going?
+      sig1 = atan2(_ssig1, _csig1),
+      omg1 = atan2(E * _somg1, _comg1),
+      lon1 = Math::AngNormalize(_lon1);
+    real x[lanes_], sig12[lanes_], ssig12[lanes_], csig12[lanes_],
+      ssig2[lanes_], csig2[lanes_], dn2[lanes_], B12[lanes_], AB1[lanes_],
+      sbet2[lanes_], cbet2[lanes_], t[lanes_], J12[lanes_];
+    for (size_t i0 = 0; i0 < n; i0 += lanes_) {
+      // The number of points in this block; the last point is repeated to
+      // fill the lanes.
+      int k = int(min(size_t(lanes_), n - i0));
+      for (int l = 0; l < lanes_; ++l)
+        x[l] = s12_a12[i0 + min(l, k - 1)];
+      if (arcmode) {
+        // Interpret s12_a12 as spherical arc length
+        for (int l = 0; l < lanes_; ++l) {
+          sig12[l] = x[l] * Math::degree<real>();
+          Math::sincosd(x[l], ssig12[l], csig12[l]);
+          B12[l] = 0;
+        }
+      } else {
+        // Interpret s12_a12 as distance
+        real stau2[lanes_], ctau2[lanes_];
+        for (int l = 0; l < lanes_; ++l) {
+          real
+            tau12 = x[l] / (_b * (1 + _A1m1)),
+            s = sin(tau12),
+            c = cos(tau12);
+          // tau2 = tau1 + tau12
+          stau2[l] = _stau1 * c + _ctau1 * s;
+          ctau2[l] = _ctau1 * c - _stau1 * s;
+          sig12[l] = tau12;
+        }
+        SinCosSeriesBlock(true, stau2, ctau2, _C1pa, nC1p_, B12);
+        for (int l = 0; l < lanes_; ++l) {
+          B12[l] = - B12[l];
+          sig12[l] = sig12[l] - (B12[l] - _B11);
+          ssig12[l] = sin(sig12[l]); csig12[l] = cos(sig12[l]);
+        }
+        if (newton) {
+          for (int l = 0; l < lanes_; ++l) {
+            ssig2[l] = _ssig1 * csig12[l] + _csig1 * ssig12[l];
+            csig2[l] = _csig1 * csig12[l] - _ssig1 * ssig12[l];
+          }
+          SinCosSeriesBlock(true, ssig2, csig2, _C1a, nC1_, B12);
+          for (int l = 0; l < lanes_; ++l) {
+            real serr = (1 + _A1m1) * (sig12[l] + (B12[l] - _B11)) -
+              x[l] / _b;
+            sig12[l] = sig12[l] - serr / sqrt(1 + _k2 * Math::sq(ssig2[l]));
+            ssig12[l] = sin(sig12[l]); csig12[l] = cos(sig12[l]);
+          }
+        }
+      }
+
+      for (int l = 0; l < lanes_; ++l) {
+        // sig2 = sig1 + sig12
+        ssig2[l] = _ssig1 * csig12[l] + _csig1 * ssig12[l];
+        csig2[l] = _csig1 * csig12[l] - _ssig1 * ssig12[l];
+        dn2[l] = sqrt(1 + _k2 * Math::sq(ssig2[l]));
+      }
+      if (B12p) {
+        if (arcmode || newton)
+          SinCosSeriesBlock(true, ssig2, csig2, _C1a, nC1_, B12);
+        for (int l = 0; l < lanes_; ++l)
+          AB1[l] = (1 + _A1m1) * (B12[l] - _B11);
+      }
+      for (int l = 0; l < lanes_; ++l) {
+        // sin(bet2) = cos(alp0) * sin(sig2)
+        sbet2[l] = _calp0 * ssig2[l];
+        cbet2[l] = Math::hypot(_salp0, _calp0 * csig2[l]);
+        if (cbet2[l] == 0)
+          // I.e., salp0 = 0, csig2 = 0.  Break the degeneracy in this case
+          cbet2[l] = csig2[l] = tiny_;
+      }
+      // salp2 = _salp0, calp2 = _calp0 * csig2
+
+      if (distp) {
+        if (arcmode)
+          for (int l = 0; l < k; ++l)
+            s12[i0 + l] = _b * ((1 + _A1m1) * sig12[l] + AB1[l]);
+        else
+          for (int l = 0; l < k; ++l)
+            s12[i0 + l] = x[l];
+      }
+
+      if (lonp) {
+        real omg12[lanes_];
+        // tan(omg2) = sin(alp0) * tan(sig2); somg2 = _salp0 * ssig2, comg2
+        // = csig2
+        if (unroll)
+          for (int l = 0; l < lanes_; ++l)
+            omg12[l] = E * (sig12[l]
+                            - (atan2(ssig2[l], csig2[l]) - sig1)
+                            + (atan2(E * (_salp0 * ssig2[l]), csig2[l])
+                               - omg1));
+        else
+          for (int l = 0; l < lanes_; ++l)
+            omg12[l] = atan2(_salp0 * ssig2[l] * _comg1 - csig2[l] * _somg1,
+                             csig2[l] * _comg1 + _salp0 * ssig2[l] * _somg1);
+        SinCosSeriesBlock(true, ssig2, csig2, _C3a, nC3_-1, t);
+        for (int l = 0; l < k; ++l) {
+          real
+            lam12 = omg12[l] + _A3c * ( sig12[l] + (t[l] - _B31)),
+            lon12 = lam12 / Math::degree<real>();
+          lon2[i0 + l] = unroll ? _lon1 + lon12 :
+            Math::AngNormalize(lon1 + Math::AngNormalize(lon12));
+        }
+      }
+
+      if (latp)
+        for (int l = 0; l < k; ++l)
+          lat2[i0 + l] = Math::atan2d(sbet2[l], _f1 * cbet2[l]);
+
+      if (azip)
+        for (int l = 0; l < k; ++l)
+          azi2[i0 + l] = Math::atan2d(_salp0, _calp0 * csig2[l]);
+
+      if (redlp || scalep) {
+        SinCosSeriesBlock(true, ssig2, csig2, _C2a, nC2_, t);
+        for (int l = 0; l < lanes_; ++l) {
+          real AB2 = (1 + _A2m1) * (t[l] - _B21);
+          J12[l] = (_A1m1 - _A2m1) * sig12[l] + (AB1[l] - AB2);
+        }
+        if (redlp)
+          for (int l = 0; l < k; ++l)
+            m12[i0 + l] = _b * ((dn2[l] * (_csig1 * ssig2[l]) -
+                                 _dn1 * (_ssig1 * csig2[l]))
+                                - _csig1 * csig2[l] * J12[l]);
+        if (scalep)
+          for (int l = 0; l < k; ++l) {
+            real tt = _k2 * (ssig2[l] - _ssig1) * (ssig2[l] + _ssig1) /
+              (_dn1 + dn2[l]);
+            M12[i0 + l] = csig12[l] +
+              (tt *  ssig2[l] -  csig2[l] * J12[l]) * _ssig1 / _dn1;
+            M21[i0 + l] = csig12[l] -
+              (tt * _ssig1 - _csig1 * J12[l]) *  ssig2[l] /  dn2[l];
+          }
+      }
+
+      if (areap) {
+        SinCosSeriesBlock(false, ssig2, csig2, _C4a, nC4_, t);
+        if (_calp0 == 0 || _salp0 == 0)
+          for (int l = 0; l < k; ++l) {
+            real
+              calp2 = _calp0 * csig2[l],
+              salp12 = _salp0 * _calp1 - calp2 * _salp1,
+              calp12 = calp2 * _calp1 + _salp0 * _salp1;
+            S12[i0 + l] = _c2 * atan2(salp12, calp12) + _A4 * (t[l] - _B41);
+          }
+        else
+          for (int l = 0; l < k; ++l) {
+            real
+              salp12 = _calp0 * _salp0 *
+              (csig12[l] <= 0 ? _csig1 * (1 - csig12[l]) + ssig12[l] * _ssig1 :
+               ssig12[l] * (_csig1 * ssig12[l] / (1 + csig12[l]) + _ssig1)),
+              calp12 = Math::sq(_salp0) + Math::sq(_calp0) * _csig1 * csig2[l];
+            S12[i0 + l] = _c2 * atan2(salp12, calp12) + _A4 * (t[l] - _B41);
+          }
+      }
+
+      if (a12)
+        for (int l = 0; l < k; ++l)
+          a12[i0 + l] = arcmode ? x[l] : sig12[l] / Math::degree<real>();
+    }
   }
 
-  void GeodesicLine::SetDistance(real s13) {
+  template<typename T>
+  void GeodesicLineT<T>::SetDistance(real s13) {
     _s13 = s13;
     real t;
     // This will set _a13 to NaN if the GeodesicLine doesn't have the
@@ -306,16 +548,26 @@ namespace geographic_lib {
     _a13 = GenPosition(false, _s13, 0u, t, t, t, t, t, t, t, t);
   }
 
-  void GeodesicLine::SetArc(real a13) {
+  template<typename T>
+  void GeodesicLineT<T>::SetArc(real a13) {
     _a13 = a13;
     // In case the GeodesicLine doesn't have the DISTANCE capability.
-    _s13 = Math::NaN();
+    _s13 = Math::NaN<real>();
     real t;
     GenPosition(true, _a13, DISTANCE, t, t, t, _s13, t, t, t, t);
   }
 
-  void GeodesicLine::GenSetDistance(bool arcmode, real s13_a13) {
+  template<typename T>
+  void GeodesicLineT<T>::GenSetDistance(bool arcmode, real s13_a13) {
     arcmode ? SetArc(s13_a13) : SetDistance(s13_a13);
   }
 
+  /// \cond SKIP
+  // Instantiate
+  template class GEOGRAPHICLIB_EXPORT GeodesicLineT<Math::real>;
+#if GEOGRAPHICLIB_PRECISION != 1
+  template class GEOGRAPHICLIB_EXPORT GeodesicLineT<float>;
+#endif
+  /// \endcond
+
 } // namespace geographic_lib
@@ -0,0 +1,198 @@
+/**
+ * \file GeodesicLineChebyshev.cpp
+ * \brief Implementation for geographic_lib::GeodesicLineChebyshev class
+ *
+ * Copyright (c) 2026 the geographic_lib authors and licensed under the
+ * MIT/X11 License.  This file is not part of the upstream GeographicLib
+ * distribution; see https://geographiclib.sourceforge.io/ for that.
+ *
+ * Each interval [u0, u0 + ds] is mapped to x in [-1, 1] and lat, lon, azi are
+ * interpolated at the m = order + 1 Chebyshev nodes x_k = cos(pi*(k+1/2)/m).
+ * The interpolant is checked at the m + 1 extrema of T_m, x_j = cos(pi*j/m),
+ * which lie between the nodes and where the error is largest.
+ **********************************************************************/
+
+#include <algorithm>
+#include <ctime>
+#include <geographic_lib/GeodesicLineChebyshev.hpp>
+#include <geographic_lib/Utility.hpp>
+
+namespace geographic_lib {
+
+  using namespace std;
+
+  GeodesicLineChebyshev::GeodesicLineChebyshev(const GeodesicLine& line,
+                                               real s13, real tol,
+                                               int order)
+    : _nint(0)
+  {
+    if (!(line.Init() &&
+          line.Capabilities(GeodesicLine::DISTANCE_IN |
+                            GeodesicLine::LONGITUDE)))
+      throw GeographicErr("GeodesicLine lacks DISTANCE_IN or LONGITUDE");
+    if (!(Math::isfinite(s13) && s13 != 0))
+      throw GeographicErr("Distance s13 is not finite and nonzero");
+    if (!(Math::isfinite(tol) && tol > 0))
+      throw GeographicErr("Tolerance is not positive");
+    if (!(order >= 2 && order <= 64))
+      throw GeographicErr("Order " + Utility::str(order) +
+                          " not in [2, 64]");
+    clock_t t0 = clock();
+    _a = line.MajorRadius();
+    _f = line.Flattening();
+    _lat1 = line.Latitude();
+    _lon1 = line.Longitude();
+    _azi1 = line.Azimuth();
+    _s0 = min(real(0), s13);
+    _s1 = max(real(0), s13);
+    _tol = tol;
+    _order = order;
+    _evals = 0;
+    _maxerr = 0;
+    const int m = _order + 1;
+    // cosines of the node angles, tc[j * m + k] = T_j(x_k)
+    vector<real> tc(m * m);
+    for (int j = 0; j < m; ++j)
+      for (int k = 0; k < m; ++k)
+        tc[j * m + k] = cos(Math::pi() * j * (k + real(0.5)) / m);
+    _bnd.push_back(_s0);
+    _nint = 1;
+    Refine(line, tc, _s0, _s1 - _s0, Math::infinity());
+    // Avoid roundoff in the end of the last interval
+    _bnd.back() = _s1;
+    _buildtime = real(clock() - t0) / CLOCKS_PER_SEC;
+  }
+
+  void GeodesicLineChebyshev::Sample(const GeodesicLine& line, real s,
+                                     real& lat, real& lon, real& azi) {
+    real t;
+    line.GenPosition(false, s,
+                     GeodesicLine::LATITUDE | GeodesicLine::LONGITUDE |
+                     GeodesicLine::AZIMUTH | GeodesicLine::LONG_UNROLL,
+                     lat, lon, azi, t, t, t, t, t);
+    ++_evals;
+  }
+
+  void GeodesicLineChebyshev::Refine(const GeodesicLine& line,
+                                     const vector<real>& tc,
+                                     real u0, real ds, real perr) {
+    // An error which is less than this and which isn't reduced by splitting
+    // the interval is attributed to roundoff (about 1e-5 m for doubles and
+    // the earth).
+    const real noise =
+      1024 * numeric_limits<real>::epsilon() * 360 * Math::degree() * _a;
+    const int m = _order + 1;
+    size_t k = _c.size();
+    _c.resize(k + 3 * m);
+    real err = Fit(line, u0, ds, tc, &_c[k]);
+    if (err <= _tol) {
+      _bnd.push_back(u0 + ds);
+      _maxerr = max(_maxerr, err);
+      return;
+    }
+    _c.resize(k);
+    // Splitting the interval adds one to the count of intervals, _nint.
+    if (_nint == maxintervals_ ||
+        (4 * err > 3 * perr && err < noise) ||
+        !Math::isfinite(err))
+      throw GeographicErr("Tolerance " + Utility::str(_tol) +
+                          " m can't be met; the error is " +
+                          Utility::str(err) + " m at s12 = " +
+                          Utility::str(u0) + " m");
+    ++_nint;
+    Refine(line, tc, u0, ds / 2, err);
+    Refine(line, tc, u0 + ds / 2, ds / 2, err);
+  }
+
+  Math::real GeodesicLineChebyshev::Fit(const GeodesicLine& line,
+                                        real u0, real ds,
+                                        const vector<real>& tc, real c[]) {
+    const int m = _order + 1;
+    const real ra = _a * Math::degree();
+    // The nodes are x_k = T_1(x_k)
+    const real* x = &tc[m];
+    vector<real> fl(m), fo(m), fa(m);
+    // Sample in order of increasing x (decreasing k) so that the azimuth can
+    // be made continuous within the interval.
+    for (int k = m; k--;) {
+      Sample(line, u0 + (x[k] + 1) * ds / 2, fl[k], fo[k], fa[k]);
+      if (k < m - 1)
+        fa[k] += 360 * floor((fa[k + 1] - fa[k]) / 360 + real(0.5));
+    }
+    for (int j = 0; j < m; ++j) {
+      real sl = 0, so = 0, sa = 0;
+      for (int k = 0; k < m; ++k) {
+        real t = tc[j * m + k];
+        sl += fl[k] * t; so += fo[k] * t; sa += fa[k] * t;
+      }
+      real w = (j ? 2 : 1) / real(m); // the j = 0 term is halved
+      c[j] = w * sl; c[m + j] = w * so; c[2 * m + j] = w * sa;
+    }
+    real maxerr = 0;
+    for (int j = 0; j <= m; ++j) {
+      real xj = cos(Math::pi() * j / m),
+        lat, lon, azi, lata, lona, azia, slat, clat;
+      Sample(line, u0 + (xj + 1) * ds / 2, lat, lon, azi);
+      Clenshaw(_order, xj, c, lata, lona, azia);
+      Math::sincosd(lat, slat, clat);
+      real err = max(abs(lata - lat),
+                     max(abs(lona - lon),
+                         abs(Math::AngDiff(azi, azia))) * clat);
+      // Written so that a NaN is propagated
+      if (!(err <= maxerr)) maxerr = err;
+    }
+    return ra * maxerr;
+  }
+
+  void GeodesicLineChebyshev::Clenshaw(int n, real x, const real c[],
+                                       real& lat, real& lon, real& azi) {
+    const int m = n + 1;
+    real y = 2 * x,
+      bl1 = 0, bl2 = 0, bo1 = 0, bo2 = 0, ba1 = 0, ba2 = 0;
+    for (int j = n; j > 0; --j) {
+      real t;
+      t = y * bl1 - bl2 + c[j];         bl2 = bl1; bl1 = t;
+      t = y * bo1 - bo2 + c[m + j];     bo2 = bo1; bo1 = t;
+      t = y * ba1 - ba2 + c[2 * m + j]; ba2 = ba1; ba1 = t;
+    }
+    lat = c[0]     + x * bl1 - bl2;
+    lon = c[m]     + x * bo1 - bo2;
+    azi = c[2 * m] + x * ba1 - ba2;
+  }
+
+  bool GeodesicLineChebyshev::GenPosition(real s12, unsigned outmask,
+                                          real& lat2, real& lon2,
+                                          real& azi2) const {
+    if (!(Init() && s12 >= _s0 && s12 <= _s1)) {
+      // Uninitialized or out of range
+      if (outmask & LATITUDE) lat2 = Math::NaN();
+      if (outmask & LONGITUDE) lon2 = Math::NaN();
+      if (outmask & AZIMUTH) azi2 = Math::NaN();
+      return false;
+    }
+    // The interval containing s12; the last interval includes _s1.
+    int i = int(upper_bound(_bnd.begin() + 1, _bnd.end() - 1, s12) -
+                (_bnd.begin() + 1));
+    real lat, lon, azi;
+    Clenshaw(_order, 2 * (s12 - _bnd[i]) / (_bnd[i + 1] - _bnd[i]) - 1,
+             &_c[3 * (_order + 1) * size_t(i)], lat, lon, azi);
+    if (outmask & LATITUDE) lat2 = lat;
+    if (outmask & LONGITUDE)
+      lon2 = (outmask & LONG_UNROLL) ? lon : Math::AngNormalize(lon);
+    if (outmask & AZIMUTH) azi2 = Math::AngNormalize(azi);
+    return true;
+  }
+
+  void GeodesicLineChebyshev::GenPositions(size_t n, const real s12[],
+                                           unsigned outmask,
+                                           real lat2[], real lon2[],
+                                           real azi2[]) const {
+    real t;
+    for (size_t i = 0; i < n; ++i)
+      GenPosition(s12[i], outmask,
+                  (outmask & LATITUDE) ? lat2[i] : t,
+                  (outmask & LONGITUDE) ? lon2[i] : t,
+                  (outmask & AZIMUTH) ? azi2[i] : t);
+  }
+
+} // namespace geographic_lib
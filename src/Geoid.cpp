@@ -8,9 +8,33 @@
  **********************************************************************/
 
 #include <geographic_lib/Geoid.hpp>
+// For rename and remove
+#include <cstdio>
 // For getenv
 #include <cstdlib>
 #include <geographic_lib/Utility.hpp>
+#include <list>
+#include <map>
+#if GEOGRAPHICLIB_CXX11_THREADS
+#  include <atomic>
+#  include <chrono>
+#  include <condition_variable>
+#  include <deque>
+#  include <mutex>
+#  include <thread>
+#else
+#  include <ctime>
+#endif
+
+#if defined(_WIN32)
+#  define WIN32_LEAN_AND_MEAN
+#  include <windows.h>
+#else
+// For mmap
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <unistd.h>
+#endif
 
 #if !defined(GEOGRAPHICLIB_DATA)
 #  if defined(_WIN32)
@@ -97,6 +121,12 @@ namespace geographic_lib {
   // genmatrix(yc,1,length(warr)).abs(c3).genmatrix(yd,length(pows),1)),2)$
   // c3:c0*c3$
 
+  const char* const Geoid::nativeid_ = "GEOID-LE";
+  const char* const Geoid::nativeext_ =
+    Geoid::pixel_size_ != 4 ? ".geoid" : ".geoid4";
+  const char* const Geoid::pgmext_ =
+    Geoid::pixel_size_ != 4 ? ".pgm" : ".pgm4";
+
   const int Geoid::c0_ = 240; // Common denominator
   const int Geoid::c3_[stencilsize_ * nterms_] = {
       9, -18, -88,    0,  96,   90,   0,   0, -60, -20,
@@ -197,8 +227,296 @@ namespace geographic_lib {
      18,  -36,    2,   0,  -66,  -51, 0,   0,  102,  31,
   };
 
+  // The tile cache.  The thread using the Geoid (the foreground) owns the
+  // map of tiles and the LRU list and so accesses them without locking.  The
+  // background thread reads the tiles requested for prefetching using its
+  // own stream and deposits them in _ready; this and the queue of requests
+  // are protected by a mutex which the foreground only locks on a miss.
+  class Geoid::TileStore {
+  public:
+    typedef unsigned long long key_t;
+    struct Tile {
+      std::vector<pixel_t> data;
+      int w;                    // width of tile (smaller at the east edge)
+      bool prefetched;          // true if prefetched and not yet used
+      std::list<key_t>::iterator pos; // position in _lru
+    };
+    const Geoid& _g;
+    const int _size;
+    const size_t _budget;
+    size_t _maxtiles, _maxready;
+    unsigned long long _hits, _misses, _prefetches;
+    std::map<key_t, Tile> _tiles;
+    std::list<key_t> _lru;      // Most recently used first
+    key_t _lastkey;
+    Tile* _last;                // The last tile used (or null)
+    // A direct-mapped index of recently used tiles to avoid searching _tiles
+    static const unsigned nrecent_ = 64;
+    key_t _recentkey[nrecent_];
+    Tile* _recent[nrecent_];
+#if GEOGRAPHICLIB_CXX11_THREADS
+    std::mutex _lock;
+    std::condition_variable _cv;
+    std::deque<key_t> _requests; // Most recent first
+    std::map<key_t, Tile> _ready;
+    bool _stop;
+    std::thread _worker;
+#endif
+
+    TileStore(const Geoid& g, size_t budget, int size, bool prefetch)
+      : _g(g)
+      , _size(size)
+      , _budget(budget)
+      , _maxtiles(0)
+      , _maxready(0)
+      , _hits(0)
+      , _misses(0)
+      , _prefetches(0)
+      , _lastkey(0)
+      , _last(0)
+    {
+      for (unsigned i = 0; i < nrecent_; ++i) {
+        _recentkey[i] = 0;
+        _recent[i] = 0;
+      }
+      size_t n = budget / (size_t(size) * size_t(size) * sizeof(pixel_t));
+      if (n < 1)
+        throw GeographicErr("Tile cache budget is smaller than a tile");
+#if GEOGRAPHICLIB_CXX11_THREADS
+      _maxready = prefetch && n >= 16 ? 8 : 0;
+#else
+      (void)prefetch;
+#endif
+      _maxtiles = n - _maxready;
+#if GEOGRAPHICLIB_CXX11_THREADS
+      _stop = false;
+      if (_maxready)
+        _worker = std::thread(&TileStore::work, this);
+#endif
+    }
+    ~TileStore() {
+#if GEOGRAPHICLIB_CXX11_THREADS
+      if (_maxready) {
+        {
+          std::lock_guard<std::mutex> l(_lock);
+          _stop = true;
+        }
+        _cv.notify_all();
+        _worker.join();
+      }
+#endif
+    }
+    int ntx() const { return (_g._width + _size - 1) / _size; }
+    int nty() const { return (_g._height + _size - 1) / _size; }
+    static key_t key(int tx, int ty)
+    { return (key_t(unsigned(ty)) << 32) | key_t(unsigned(tx)); }
+    static unsigned slot(key_t k)
+    { return unsigned(k ^ (k >> 29)) & (nrecent_ - 1); }
+    // Read tile k from str
+    void read(std::istream& str, key_t k, Tile& t) const {
+#if GEOGRAPHICLIB_GEOID_STATISTICS
+      double t0 = wallclock();
+#endif
+      int
+        tx = int(k & 0xffffffffU), ty = int(k >> 32),
+        x0 = tx * _size, y0 = ty * _size,
+        h = min(_size, _g._height - y0);
+      t.w = min(_size, _g._width - x0);
+      t.prefetched = false;
+      t.data.resize(size_t(t.w) * size_t(h));
+      for (int r = 0; r < h; ++r) {
+        str.seekg(streamoff(_g._datastart + pixel_size_ *
+                            ((unsigned long long)(y0 + r) * _g._swidth +
+                             (unsigned long long)(x0))));
+        pixel_t* row = &t.data[size_t(r) * size_t(t.w)];
+        if (_g._bigend)
+          Utility::readarray<pixel_t, pixel_t, true>(str, row, t.w);
+        else
+          Utility::readarray<pixel_t, pixel_t, false>(str, row, t.w);
+      }
+#if GEOGRAPHICLIB_GEOID_STATISTICS
+      // When called by the background thread, this goes to its statistics
+      // and so is invisible to the caller.
+      Stats().AddRead(pixel_size_ * (unsigned long long)(t.data.size()),
+                      wallclock() - t0);
+#endif
+    }
+    // Evict tiles from the least recently used end until there's room for n
+    // more
+    void makeroom(size_t n) {
+      while (!_lru.empty() && _tiles.size() + n > _maxtiles) {
+        key_t k1 = _lru.back();
+        _lru.pop_back();
+        if (_last && k1 == _lastkey)
+          _last = 0;
+        unsigned j = slot(k1);
+        if (_recent[j] && _recentkey[j] == k1)
+          _recent[j] = 0;
+        _tiles.erase(k1);
+      }
+    }
+    // Add t to the cache as tile k (the contents of t are swapped out); call
+    // makeroom first.  A tile which has been used goes at the most recently
+    // used end of _lru.  A prefetched tile goes at the least recently used
+    // end, so that it is the first to be evicted if it's not used; it is
+    // moved to the front by find when it is first used.
+    std::map<key_t, Tile>::iterator insert(key_t k, Tile& t) {
+      Tile& t1 = _tiles[k];
+      t1.data.swap(t.data);
+      t1.w = t.w;
+      t1.prefetched = t.prefetched;
+      if (t1.prefetched) {
+        _lru.push_back(k);
+        t1.pos = --_lru.end();
+      } else {
+        _lru.push_front(k);
+        t1.pos = _lru.begin();
+      }
+      return _tiles.find(k);
+    }
+    // Move the prefetched tiles into the cache
+    void drain() {
+#if GEOGRAPHICLIB_CXX11_THREADS
+      if (!_maxready) return;
+      std::lock_guard<std::mutex> l(_lock);
+      size_t n = 0;
+      for (std::map<key_t, Tile>::iterator it = _ready.begin();
+           it != _ready.end(); ++it)
+        if (_tiles.find(it->first) == _tiles.end())
+          ++n;
+      // Make room for all the new tiles at once; otherwise, since they're
+      // placed at the end of _lru, each would evict the one before it.
+      makeroom(n);
+      for (std::map<key_t, Tile>::iterator it = _ready.begin();
+           it != _ready.end() && _tiles.size() < _maxtiles; ++it)
+        if (_tiles.find(it->first) == _tiles.end())
+          insert(it->first, it->second);
+      _ready.clear();
+#endif
+    }
+    // Queue the neighbors of tile k which aren't cached for prefetching
+    void request(key_t k) {
+#if GEOGRAPHICLIB_CXX11_THREADS
+      int tx = int(k & 0xffffffffU), ty = int(k >> 32), nx = ntx(), ny = nty();
+      key_t keys[8];
+      int n = 0;
+      for (int dy = -1; dy <= 1; ++dy) {
+        int ty1 = ty + dy;
+        if (ty1 < 0 || ty1 >= ny) continue;
+        for (int dx = -1; dx <= 1; ++dx) {
+          if (dx == 0 && dy == 0) continue;
+          int tx1 = (tx + dx + nx) % nx;
+          key_t k1 = key(tx1, ty1);
+          if (_tiles.find(k1) == _tiles.end())
+            keys[n++] = k1;
+        }
+      }
+      if (n == 0) return;
+      {
+        std::lock_guard<std::mutex> l(_lock);
+        for (int i = n; i--;)
+          _requests.push_front(keys[i]);
+        // Drop stale requests
+        if (_requests.size() > 2 * _maxready)
+          _requests.resize(2 * _maxready);
+      }
+      _cv.notify_one();
+#else
+      (void)k;
+#endif
+    }
+#if GEOGRAPHICLIB_CXX11_THREADS
+    // The background thread
+    void work() {
+      std::ifstream str(_g._filename.c_str(), std::ios::binary);
+      std::unique_lock<std::mutex> l(_lock);
+      while (true) {
+        while (!_stop && _requests.empty())
+          _cv.wait(l);
+        if (_stop) return;
+        key_t k = _requests.front();
+        _requests.pop_front();
+        if (_ready.size() >= _maxready || _ready.find(k) != _ready.end())
+          continue;
+        l.unlock();
+        Tile t;
+        bool ok = true;
+        try {
+          read(str, k, t);
+        }
+        catch (const std::exception&) {
+          // Leave the tile to be read by the foreground
+          ok = false;
+          str.clear();
+        }
+        l.lock();
+        if (ok && _ready.size() < _maxready) {
+          Tile& t1 = _ready[k];
+          t1.data.swap(t.data);
+          t1.w = t.w;
+          t1.prefetched = true;
+          ++_prefetches;
+        }
+      }
+    }
+#endif
+    // Find tile k, reading it if necessary
+    Tile& find(key_t k) {
+      unsigned j = slot(k);
+      if (_recent[j] && _recentkey[j] == k && !_recent[j]->prefetched) {
+        ++_hits;
+        _lru.splice(_lru.begin(), _lru, _recent[j]->pos);
+        return *_recent[j];
+      }
+      std::map<key_t, Tile>::iterator it = _tiles.find(k);
+      if (it == _tiles.end()) {
+        drain();
+        it = _tiles.find(k);
+      }
+      bool neighbors = false;
+      if (it != _tiles.end()) {
+        ++_hits;
+        _lru.splice(_lru.begin(), _lru, it->second.pos);
+        if (it->second.prefetched) {
+          it->second.prefetched = false;
+          neighbors = true;
+        }
+      } else {
+        ++_misses;
+        Tile t;
+        read(_g._file, k, t);
+        makeroom(1);
+        it = insert(k, t);
+        neighbors = true;
+      }
+      if (neighbors && _maxready)
+        request(k);
+      _recentkey[j] = k;
+      _recent[j] = &it->second;
+      return it->second;
+    }
+    unsigned val(int ix, int iy) {
+      int tx = ix / _size, ty = iy / _size;
+      key_t k = key(tx, ty);
+      if (_last && k == _lastkey)
+        ++_hits;
+      else {
+        _last = &find(k);
+        _lastkey = k;
+      }
+      return _last->data[size_t(iy - ty * _size) * size_t(_last->w) +
+                         size_t(ix - tx * _size)];
+    }
+    unsigned long long prefetches() {
+#if GEOGRAPHICLIB_CXX11_THREADS
+      std::lock_guard<std::mutex> l(_lock);
+#endif
+      return _prefetches;
+    }
+  };
+
   Geoid::Geoid(const std::string& name, const std::string& path, bool cubic,
-               bool threadsafe)
+               bool threadsafe, bool memorymap)
     : _name(name)
     , _dir(path)
     , _cubic(cubic)
@@ -206,19 +524,69 @@ namespace geographic_lib {
     , _e2( (2 - Constants::WGS84_f()) * Constants::WGS84_f() )
     , _degree( Math::degree() )
     , _eps( sqrt(numeric_limits<real>::epsilon()) )
+    , _map(0)
+    , _mapsize(0)
     , _threadsafe(false)        // Set after cache is read
+    , _serial(nextserial())
+    , _tiles(0)
   {
     GEOGRAPHICLIB_STATIC_ASSERT(sizeof(pixel_t) == pixel_size_,
                                 "pixel_t has the wrong size");
     if (_dir.empty())
       _dir = DefaultGeoidPath();
-    _filename = _dir + "/" + _name + (pixel_size_ != 4 ? ".pgm" : ".pgm4");
+    // Use the native file if it exists and its header can be read;
+    // otherwise use the PGM file.
+    bool native = false;
+    string nativeerr;
+    _filename = _dir + "/" + _name + nativeext_;
     _file.open(_filename.c_str(), ios::binary);
-    if (!(_file.good()))
-      throw GeographicErr("File not readable " + _filename);
+    if (_file.good()) {
+      try {
+        readheader();
+        native = true;
+      }
+      catch (const GeographicErr& e) {
+        nativeerr = e.what();
+      }
+    }
+    if (!native) {
+      _file.close();
+      _file.clear();
+      _filename = _dir + "/" + _name + pgmext_;
+      _file.open(_filename.c_str(), ios::binary);
+      if (!(_file.good()))
+        // Report the error with the native file if there was one
+        throw GeographicErr(nativeerr.empty() ?
+                            "File not readable " + _filename : nativeerr);
+      readheader();
+    }
+    _rlonres = _width / real(360);
+    _rlatres = (_height - 1) / real(180);
+    _cache = false;
+    _cell._serial = _serial;
+    // Ensure that file errors throw exceptions
+    _file.exceptions(ifstream::eofbit | ifstream::failbit | ifstream::badbit);
+    if (memorymap) {
+      // The file length was checked above
+      _mapsize = _datastart +
+        pixel_size_ * _swidth * (unsigned long long)(_height);
+      mapfile();
+      _file.close();
+    }
+    if (threadsafe) {
+      if (!_map) {
+        CacheAll();
+        _file.close();
+      }
+      _threadsafe = true;
+    }
+  }
+
+  void Geoid::readheader() {
     string s;
-    if (!(getline(_file, s) && s == "P5"))
+    if (!(getline(_file, s) && (s == "P5" || s == nativeid_)))
       throw GeographicErr("File not in PGM format " + _filename);
+    _bigend = s == "P5";
     _offset = numeric_limits<real>::max();
     _scale = 0;
     _maxerror = _rmserror = -1;
@@ -289,115 +657,476 @@ namespace geographic_lib {
       // Possibly this test should be "<" because the file contains, e.g., a
       // second image.  However, for now we are more strict.
       throw GeographicErr("File has the wrong length " + _filename);
-    _rlonres = _width / real(360);
-    _rlatres = (_height - 1) / real(180);
-    _cache = false;
-    _ix = _width;
-    _iy = _height;
-    // Ensure that file errors throw exceptions
-    _file.exceptions(ifstream::eofbit | ifstream::failbit | ifstream::badbit);
-    if (threadsafe) {
-      CacheAll();
-      _file.close();
-      _threadsafe = true;
+  }
+
+  Geoid::~Geoid() {
+    delete _tiles;
+    unmapfile();
+  }
+
+#if GEOGRAPHICLIB_GEOID_STATISTICS
+  GeoidStatistics& Geoid::Stats() {
+#  if GEOGRAPHICLIB_CXX11_THREADS
+    static thread_local GeoidStatistics stats;
+#  else
+    static GeoidStatistics stats;
+#  endif
+    return stats;
+  }
+#endif
+
+  GeoidStatistics Geoid::Statistics() {
+#if GEOGRAPHICLIB_GEOID_STATISTICS
+    return Stats();
+#else
+    return GeoidStatistics();
+#endif
+  }
+
+  void Geoid::ResetStatistics() {
+#if GEOGRAPHICLIB_GEOID_STATISTICS
+    Stats().Reset();
+#endif
+  }
+
+  double Geoid::wallclock() {
+#if GEOGRAPHICLIB_CXX11_THREADS
+    return chrono::duration<double>(chrono::steady_clock::now()
+                                    .time_since_epoch()).count();
+#else
+    return double(clock()) / CLOCKS_PER_SEC;
+#endif
+  }
+
+  unsigned long long Geoid::nextserial() {
+#if GEOGRAPHICLIB_CXX11_THREADS
+    static atomic<unsigned long long> serial(0);
+#else
+    static unsigned long long serial = 0;
+#endif
+    return ++serial;
+  }
+
+  void Geoid::readpixels(pixel_t array[], size_t num) const {
+#if GEOGRAPHICLIB_GEOID_STATISTICS
+    double t = wallclock();
+#endif
+    if (_bigend)
+      Utility::readarray<pixel_t, pixel_t, true>(_file, array, num);
+    else
+      Utility::readarray<pixel_t, pixel_t, false>(_file, array, num);
+#if GEOGRAPHICLIB_GEOID_STATISTICS
+    Stats().AddRead(pixel_size_ * (unsigned long long)(num), wallclock() - t);
+#endif
+  }
+
+  unsigned Geoid::fileval(int ix, int iy) const {
+    try {
+#if GEOGRAPHICLIB_GEOID_STATISTICS
+      GeoidStatistics& stats = Stats();
+      double t = wallclock();
+#endif
+      filepos(ix, iy);
+      // initial values to suppress warnings in case read fails
+      char a[pixel_size_] = {0};
+      _file.read(a, pixel_size_);
+#if GEOGRAPHICLIB_GEOID_STATISTICS
+      ++stats.filereads;
+      stats.AddRead(pixel_size_, wallclock() - t);
+#endif
+      return pixelval(reinterpret_cast<unsigned char*>(a));
+    }
+    catch (const exception& e) {
+      // throw GeographicErr("Error reading " + _filename + ": "
+      //                      + e.what());
+      // triggers complaints about the "binary '+'" under Visual Studio.
+      // So use '+=' instead.
+      string err("Error reading ");
+      err += _filename;
+      err += ": ";
+      err += e.what();
+      throw GeographicErr(err);
     }
   }
 
-  Math::real Geoid::height(real lat, real lon) const {
-    lat = Math::LatFix(lat);
-    if (Math::isnan(lat) || Math::isnan(lon)) {
-      return Math::NaN();
+  unsigned Geoid::tileval(int ix, int iy) const {
+    try {
+      return _tiles->val(ix, iy);
     }
+    catch (const exception& e) {
+      string err("Error reading ");
+      err += _filename;
+      err += ": ";
+      err += e.what();
+      throw GeographicErr(err);
+    }
+  }
+
+  void Geoid::mapfile() {
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(_filename.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                              0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
+    if (file == INVALID_HANDLE_VALUE)
+      throw GeographicErr("Cannot map file " + _filename);
+    HANDLE mapping = CreateFileMappingA(file, 0, PAGE_READONLY, 0, 0, 0);
+    CloseHandle(file);
+    if (!mapping)
+      throw GeographicErr("Cannot map file " + _filename);
+    // The view remains valid after the handles are closed
+    void* map = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!map)
+      throw GeographicErr("Cannot map file " + _filename);
+#else
+    if (_mapsize != (unsigned long long)(size_t(_mapsize)))
+      throw GeographicErr("File too large to map " + _filename);
+    int fd = open(_filename.c_str(), O_RDONLY);
+    if (fd < 0)
+      throw GeographicErr("Cannot map file " + _filename);
+    // The mapping remains valid after the file is closed
+    void* map = mmap(0, size_t(_mapsize), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+      throw GeographicErr("Cannot map file " + _filename);
+#endif
+    _map = static_cast<const unsigned char*>(map);
+  }
+
+  void Geoid::unmapfile() {
+    if (!_map) return;
+#if defined(_WIN32)
+    UnmapViewOfFile(_map);
+#else
+    munmap(const_cast<unsigned char*>(_map), size_t(_mapsize));
+#endif
+    _map = 0;
+  }
+
+  bool Geoid::cellpos(real lat, real lon,
+                      int& ix, int& iy, real& fx, real& fy) const {
+    lat = Math::LatFix(lat);
+    if (Math::isnan(lat) || Math::isnan(lon))
+      return false;
     lon = Math::AngNormalize(lon);
-    real
-      fx =  lon * _rlonres,
-      fy = -lat * _rlatres;
-    int
-      ix = int(floor(fx)),
-      iy = min((_height - 1)/2 - 1, int(floor(fy)));
+    fx =  lon * _rlonres;
+    fy = -lat * _rlatres;
+    ix = int(floor(fx));
+    iy = min((_height - 1)/2 - 1, int(floor(fy)));
     fx -= ix;
     fy -= iy;
     iy += (_height - 1)/2;
     ix += ix < 0 ? _width : (ix >= _width ? -_width : 0);
-    real v00 = 0, v01 = 0, v10 = 0, v11 = 0;
-    real t[nterms_];
+    return true;
+  }
 
-    if (_threadsafe || !(ix == _ix && iy == _iy)) {
-      if (!_cubic) {
-        v00 = rawval(ix    , iy    );
-        v01 = rawval(ix + 1, iy    );
-        v10 = rawval(ix    , iy + 1);
-        v11 = rawval(ix + 1, iy + 1);
-      } else {
-        real v[stencilsize_];
-        int k = 0;
-        v[k++] = rawval(ix    , iy - 1);
-        v[k++] = rawval(ix + 1, iy - 1);
-        v[k++] = rawval(ix - 1, iy    );
-        v[k++] = rawval(ix    , iy    );
-        v[k++] = rawval(ix + 1, iy    );
-        v[k++] = rawval(ix + 2, iy    );
-        v[k++] = rawval(ix - 1, iy + 1);
-        v[k++] = rawval(ix    , iy + 1);
-        v[k++] = rawval(ix + 1, iy + 1);
-        v[k++] = rawval(ix + 2, iy + 1);
-        v[k++] = rawval(ix    , iy + 2);
-        v[k++] = rawval(ix + 1, iy + 2);
-
-        const int* c3x = iy == 0 ? c3n_ : (iy == _height - 2 ? c3s_ : c3_);
-        int c0x = iy == 0 ? c0n_ : (iy == _height - 2 ? c0s_ : c0_);
-        for (unsigned i = 0; i < nterms_; ++i) {
-          t[i] = 0;
-          for (unsigned j = 0; j < stencilsize_; ++j)
-            t[i] += v[j] * c3x[nterms_ * j + i];
-          t[i] /= c0x;
-        }
+  void Geoid::cellstencil(int ix, int iy, real v[]) const {
+    int k = 0;
+    if (!_cubic) {
+      v[k++] = rawval(ix    , iy    );
+      v[k++] = rawval(ix + 1, iy    );
+      v[k++] = rawval(ix    , iy + 1);
+      v[k++] = rawval(ix + 1, iy + 1);
+    } else {
+      v[k++] = rawval(ix    , iy - 1);
+      v[k++] = rawval(ix + 1, iy - 1);
+      v[k++] = rawval(ix - 1, iy    );
+      v[k++] = rawval(ix    , iy    );
+      v[k++] = rawval(ix + 1, iy    );
+      v[k++] = rawval(ix + 2, iy    );
+      v[k++] = rawval(ix - 1, iy + 1);
+      v[k++] = rawval(ix    , iy + 1);
+      v[k++] = rawval(ix + 1, iy + 1);
+      v[k++] = rawval(ix + 2, iy + 1);
+      v[k++] = rawval(ix    , iy + 2);
+      v[k++] = rawval(ix + 1, iy + 2);
+    }
+  }
+
+  void Geoid::cellcoeffs(int ix, int iy, CellCache& cell) const {
+    if (cell._serial != _serial) {
+      // Reset a cell cache last used with a different Geoid
+      cell._serial = _serial;
+      cell._ix = cell._iy = -1;
+    }
+    if (ix == cell._ix && iy == cell._iy) {
+#if GEOGRAPHICLIB_GEOID_STATISTICS
+      ++Stats().cellhits;
+#endif
+      return;                   // same cell; use cached coefficients
+    }
+#if GEOGRAPHICLIB_GEOID_STATISTICS
+    ++Stats().cellmisses;
+#endif
+    // Don't update cell until all the data has been read
+    real v[stencilsize_];
+    cellstencil(ix, iy, v);
+    if (!_cubic) {
+      cell._v00 = v[0];
+      cell._v01 = v[1];
+      cell._v10 = v[2];
+      cell._v11 = v[3];
+    } else {
+      const int* c3x = iy == 0 ? c3n_ : (iy == _height - 2 ? c3s_ : c3_);
+      int c0x = iy == 0 ? c0n_ : (iy == _height - 2 ? c0s_ : c0_);
+      for (unsigned i = 0; i < nterms_; ++i) {
+        real t = 0;
+        for (unsigned j = 0; j < stencilsize_; ++j)
+          t += v[j] * c3x[nterms_ * j + i];
+        cell._t[i] = t / c0x;
       }
-    } else { // same cell; used cached coefficients
-      if (!_cubic) {
-        v00 = _v00;
-        v01 = _v01;
-        v10 = _v10;
-        v11 = _v11;
-      } else
-        copy(_t, _t + nterms_, t);
     }
+    cell._ix = ix;
+    cell._iy = iy;
+  }
+
+  Math::real Geoid::height(real lat, real lon, CellCache* cell) const {
+    int ix, iy;
+    real fx, fy;
+    if (!cellpos(lat, lon, ix, iy, fx, fy))
+      return Math::NaN();
+    CellCache tcell;
+    if (!cell) cell = &tcell;
+    cellcoeffs(ix, iy, *cell);
     if (!_cubic) {
       real
-        a = (1 - fx) * v00 + fx * v01,
-        b = (1 - fx) * v10 + fx * v11,
-        c = (1 - fy) * a + fy * b,
-        h = _offset + _scale * c;
-      if (!_threadsafe) {
-        _ix = ix;
-        _iy = iy;
-        _v00 = v00;
-        _v01 = v01;
-        _v10 = v10;
-        _v11 = v11;
-      }
-      return h;
+        a = (1 - fx) * cell->_v00 + fx * cell->_v01,
+        b = (1 - fx) * cell->_v10 + fx * cell->_v11,
+        c = (1 - fy) * a + fy * b;
+      return _offset + _scale * c;
     } else {
+      const real* t = cell->_t;
       real h = t[0] + fx * (t[1] + fx * (t[3] + fx * t[6])) +
         fy * (t[2] + fx * (t[4] + fx * t[7]) +
              fy * (t[5] + fx * t[8] + fy * t[9]));
-      h = _offset + _scale * h;
-      if (!_threadsafe) {
-        _ix = ix;
-        _iy = iy;
-        copy(t, t + nterms_, _t);
+      return _offset + _scale * h;
+    }
+  }
+
+  void Geoid::heights(size_t n, const real lat[], const real lon[], real h[],
+                      CellCache& cell, Workspace& w) const {
+    // n <= the size of w.  Group the points by cell with a counting sort.  Cells are
+    // assigned buckets, in order of first appearance, via a small hash
+    // table; w.bucket[i] = nb marks a point i with a NaN coordinate.
+    unsigned nb = 0;            // The number of buckets
+    const unsigned hmask = w.hmask;
+    fill(w.hbucket.begin(), w.hbucket.end(), 0U);   // 0 means empty
+    unsigned long long lastc = 0;
+    unsigned lastb = 0;
+    for (size_t i = 0; i < n; ++i) {
+      int ix, iy;
+      if (!cellpos(lat[i], lon[i], ix, iy, w.fx[i], w.fy[i])) {
+        w.bucket[i] = unsigned(batch_);
+        h[i] = Math::NaN();
+        continue;
       }
-      return h;
+      unsigned long long c = (unsigned long long)(iy) * _swidth +
+        (unsigned long long)(ix);
+      if (nb == 0 || c != lastc) {
+        // Not the same cell as the last point; look it up
+        unsigned k = unsigned((c * 0x9e3779b97f4a7c15ULL) >> 40) & hmask;
+        while (w.hbucket[k] && w.hcell[k] != c)
+          k = (k + 1) & hmask;
+        if (!w.hbucket[k]) {
+          w.hcell[k] = c;
+          w.bcell[nb] = c;
+          w.count[nb] = 0;
+          w.hbucket[k] = ++nb;  // Store bucket + 1
+        }
+        lastc = c;
+        lastb = w.hbucket[k] - 1;
+      }
+      w.bucket[i] = lastb;
+      ++w.count[lastb];
+    }
+    // Convert counts to offsets and place the points in w.order
+    for (unsigned b = 0, off = 0; b < nb; ++b) {
+      unsigned l = w.count[b];
+      w.count[b] = off;
+      off += l;
+    }
+    for (size_t i = 0; i < n; ++i)
+      if (w.bucket[i] < nb)
+        w.order[w.count[w.bucket[i]]++] = unsigned(i);
+    // Now count[b] is the end of bucket b
+    const real offset = _offset, scale = _scale;
+    for (unsigned b = 0, k0 = 0; b < nb; ++b) {
+      unsigned k1 = w.count[b], l = k1 - k0;
+      // The points in bucket b lie in the same cell.  Compute its
+      // coefficients just once and gather the points into contiguous arrays
+      // so that the compiler can vectorize the evaluation of the interpolant.
+      cellcoeffs(int(w.bcell[b] % _swidth), int(w.bcell[b] / _swidth), cell);
+      for (unsigned k = 0; k < l; ++k) {
+        unsigned i = w.order[k0 + k];
+        w.gx[k] = w.fx[i]; w.gy[k] = w.fy[i];
+      }
+      const real* gx = &w.gx[0];
+      const real* gy = &w.gy[0];
+      real* gh = &w.gh[0];
+      if (!_cubic) {
+        const real
+          v00 = cell._v00, v01 = cell._v01, v10 = cell._v10, v11 = cell._v11;
+        for (unsigned k = 0; k < l; ++k) {
+          real
+            fx = gx[k], fy = gy[k],
+            a = (1 - fx) * v00 + fx * v01,
+            b = (1 - fx) * v10 + fx * v11,
+            c = (1 - fy) * a + fy * b;
+          gh[k] = offset + scale * c;
+        }
+      } else {
+        const real
+          t0 = cell._t[0], t1 = cell._t[1], t2 = cell._t[2], t3 = cell._t[3],
+          t4 = cell._t[4], t5 = cell._t[5], t6 = cell._t[6], t7 = cell._t[7],
+          t8 = cell._t[8], t9 = cell._t[9];
+        for (unsigned k = 0; k < l; ++k) {
+          real
+            fx = gx[k], fy = gy[k],
+            v = t0 + fx * (t1 + fx * (t3 + fx * t6)) +
+            fy * (t2 + fx * (t4 + fx * t7) +
+                 fy * (t5 + fx * t8 + fy * t9));
+          gh[k] = offset + scale * v;
+        }
+      }
+      for (unsigned k = 0; k < l; ++k)
+        h[w.order[k0 + k]] = gh[k];
+      k0 = k1;
+    }
+  }
+
+  void Geoid::Heights(size_t n, const real lat[], const real lon[],
+                      real h[]) const {
+    if (n == 0)
+      return;
+    CellCache cell;
+    Workspace w(unsigned(min(n, size_t(batch_))));
+    for (size_t i = 0; i < n; i += batch_)
+      heights(min(n - i, size_t(batch_)), lat + i, lon + i, h + i, cell, w);
+  }
+
+  void Geoid::ConvertHeight(size_t n, const real lat[], const real lon[],
+                            const real h[], convertflag d,
+                            real hout[]) const {
+    if (n == 0)
+      return;
+    CellCache cell;
+    Workspace w(unsigned(min(n, size_t(batch_))));
+    // Compute the geoid heights into a buffer so that hout can be h
+    real* geoid = &w.hbuf[0];
+    for (size_t i = 0; i < n; i += batch_) {
+      size_t l = min(n - i, size_t(batch_));
+      heights(l, lat + i, lon + i, geoid, cell, w);
+      for (size_t k = 0; k < l; ++k)
+        hout[i + k] = h[i + k] + real(d) * geoid[k];
+    }
+  }
+
+  void Geoid::Row(real lat, real lon0, real dlon, size_t n, real h[]) const {
+    if (n == 0)
+      return;
+    int ix, iy;
+    real fx, fy;
+    if (!(Math::isfinite(lon0) && Math::isfinite(dlon) &&
+          cellpos(lat, lon0, ix, iy, fx, fy))) {
+      for (size_t j = 0; j < n; ++j)
+        h[j] = Math::NaN();
+      return;
+    }
+    // Fold the dependence on fy into the weights of the stencil values so
+    // that the interpolant in cell ix is the polynomial p[0] + p[1]*fx +
+    // p[2]*fx^2 + p[3]*fx^3, where p[m] = sum(wt[4*k+m] * v[k], k).
+    real wt[4 * stencilsize_];
+    unsigned nv = _cubic ? stencilsize_ : 4, np = _cubic ? 4 : 2;
+    if (!_cubic) {
+      // v = (v00, v01, v10, v11)
+      real w0 = 1 - fy, w1 = fy;
+      wt[0] = w0; wt[1] = 0;
+      wt[4] = 0;  wt[5] = w0;
+      wt[8] = w1; wt[9] = 0;
+      wt[12] = 0; wt[13] = w1;
+    } else {
+      const int* c3x = iy == 0 ? c3n_ : (iy == _height - 2 ? c3s_ : c3_);
+      real c0x = real(iy == 0 ? c0n_ : (iy == _height - 2 ? c0s_ : c0_));
+      for (unsigned k = 0; k < stencilsize_; ++k) {
+        const int* c = c3x + nterms_ * k;
+        wt[4*k + 0] = (c[0] + fy * (c[2] + fy * (c[5] + fy * c[9]))) / c0x;
+        wt[4*k + 1] = (c[1] + fy * (c[4] + fy * c[8])) / c0x;
+        wt[4*k + 2] = (c[3] + fy * c[7]) / c0x;
+        wt[4*k + 3] = c[6] / c0x;
+      }
+    }
+    // x is the position along the row in units of the grid spacing; the
+    // current cell spans [cx, cx + 1) where cx isn't reduced to [0, _width)
+    // and its reduced counterpart is ix.
+    const real x0 = ix + fx, dx = dlon * _rlonres;
+    const real offset = _offset, scale = _scale;
+    real v[stencilsize_], p[4] = {0, 0, 0, 0};
+    int cx = ix;
+    for (size_t j = 0; j < n; ++j) {
+      // Compute x from j (instead of accumulating dx) to avoid a drift in the
+      // longitude.
+      real x = x0 + real(j) * dx;
+      if (j == 0 || !(x >= cx && x < cx + 1)) {
+        int nx = int(floor(x));
+        if (j > 0 && nx == cx + 1) {
+          // Moved one cell east; shift the stencil west and read the new
+          // eastern values.
+          ix = ix + 1 == _width ? 0 : ix + 1;
+          if (!_cubic) {
+            v[0] = v[1]; v[2] = v[3];
+            v[1] = rawval(ix + 1, iy    );
+            v[3] = rawval(ix + 1, iy + 1);
+          } else {
+            v[0] = v[1]; v[2] = v[3]; v[3] = v[4]; v[4] = v[5];
+            v[6] = v[7]; v[7] = v[8]; v[8] = v[9]; v[10] = v[11];
+            v[1]  = rawval(ix + 1, iy - 1);
+            v[5]  = rawval(ix + 2, iy    );
+            v[9]  = rawval(ix + 2, iy + 1);
+            v[11] = rawval(ix + 1, iy + 2);
+          }
+        } else if (j > 0 && nx == cx - 1) {
+          // Moved one cell west
+          ix = ix == 0 ? _width - 1 : ix - 1;
+          if (!_cubic) {
+            v[1] = v[0]; v[3] = v[2];
+            v[0] = rawval(ix    , iy    );
+            v[2] = rawval(ix    , iy + 1);
+          } else {
+            v[1] = v[0]; v[5] = v[4]; v[4] = v[3]; v[3] = v[2];
+            v[9] = v[8]; v[8] = v[7]; v[7] = v[6]; v[11] = v[10];
+            v[0]  = rawval(ix    , iy - 1);
+            v[2]  = rawval(ix - 1, iy    );
+            v[6]  = rawval(ix - 1, iy + 1);
+            v[10] = rawval(ix    , iy + 2);
+          }
+        } else {
+          ix = nx % _width;
+          if (ix < 0) ix += _width;
+          cellstencil(ix, iy, v);
+        }
+        cx = nx;
+        for (unsigned m = 0; m < np; ++m) {
+          real t = 0;
+          for (unsigned k = 0; k < nv; ++k)
+            t += wt[4*k + m] * v[k];
+          p[m] = t;
+        }
+      }
+      real f = x - cx;
+      h[j] = offset + scale *
+        (_cubic ? p[0] + f * (p[1] + f * (p[2] + f * p[3])) :
+         (1 - f) * p[0] + f * p[1]);
     }
   }
 
   void Geoid::CacheClear() const {
     if (!_threadsafe) {
       _cache = false;
+      delete _tiles;
+      _tiles = 0;
       try {
         _data.clear();
         // Use swap to release memory back to system
-        vector< vector<pixel_t> >().swap(_data);
+        vector<pixel_t>().swap(_data);
       }
       catch (const exception&) {
       }
@@ -407,6 +1136,14 @@ namespace geographic_lib {
   void Geoid::CacheArea(real south, real west, real north, real east) const {
     if (_threadsafe)
       throw GeographicErr("Attempt to change cache of threadsafe Geoid");
+    if (_map)
+      // All the data is accessible in memory already
+      return;
+    if (_tiles) {
+      // The rectangular cache replaces the tile cache
+      delete _tiles;
+      _tiles = 0;
+    }
     if (south > north) {
       CacheClear();
       return;
@@ -440,16 +1177,14 @@ namespace geographic_lib {
       ie += iw < 0 ? _width : (iw >= _width ? -_width : 0);
       iw += iw < 0 ? _width : (iw >= _width ? -_width : 0);
     }
-    int oysize = int(_data.size());
     _xsize = ie - iw + 1;
     _ysize = is - in + 1;
     _xoffset = iw;
     _yoffset = in;
 
     try {
-      _data.resize(_ysize, vector<pixel_t>(_xsize));
-      for (int iy = min(oysize, _ysize); iy--;)
-        _data[iy].resize(_xsize);
+      // A single contiguous allocation for the whole area
+      _data.resize(size_t(_ysize) * size_t(_xsize));
     }
     catch (const bad_alloc&) {
       CacheClear();
@@ -457,7 +1192,20 @@ namespace geographic_lib {
     }
 
     try {
+      // [ya, yb) is the range of rows read in one go
+      int ya = 0, yb = 0;
+      if (_xsize == _width) {
+        // The rows within the file are contiguous
+        ya = max(in, 0);
+        yb = min(is, _height - 1) + 1;
+        filepos(0, ya);
+        readpixels(&_data[size_t(ya - in) * size_t(_xsize)],
+                   size_t(yb - ya) * size_t(_xsize));
+      }
       for (int iy = in; iy <= is; ++iy) {
+        if (iy >= ya && iy < yb)
+          // Already read
+          continue;
         int iy1 = iy, iw1 = iw;
         if (iy < 0 || iy >= _height) {
           // Allow points "beyond" the poles to support interpolation
@@ -467,14 +1215,13 @@ namespace geographic_lib {
             iw1 -= _width;
         }
         int xs1 = min(_width - iw1, _xsize);
+        pixel_t* row = &_data[size_t(iy - in) * size_t(_xsize)];
         filepos(iw1, iy1);
-        Utility::readarray<pixel_t, pixel_t, true>
-          (_file, &(_data[iy - in][0]), xs1);
+        readpixels(row, xs1);
         if (xs1 < _xsize) {
           // Wrap around longitude = 0
           filepos(0, iy1);
-          Utility::readarray<pixel_t, pixel_t, true>
-            (_file, &(_data[iy - in][xs1]), _xsize - xs1);
+          readpixels(row + xs1, _xsize - xs1);
         }
       }
       _cache = true;
@@ -485,6 +1232,119 @@ namespace geographic_lib {
     }
   }
 
+  void Geoid::CacheTiles(size_t budget, int tilesize, bool prefetch) const {
+    if (_threadsafe)
+      throw GeographicErr("Attempt to change cache of threadsafe Geoid");
+    if (_map)
+      // All the data is accessible in memory already
+      return;
+    if (!(tilesize > 0))
+      throw GeographicErr("Tile size must be positive");
+    CacheClear();
+    try {
+      _tiles = new TileStore(*this, budget, tilesize, prefetch);
+    }
+    catch (const bad_alloc&) {
+      throw GeographicErr("Insufficient memory for caching " + _filename);
+    }
+  }
+
+  void Geoid::WriteNative(const std::string& filename) const {
+    // Always convert the PGM file (even if this Geoid was read from a native
+    // file, which may be stale).
+    string pgmname = _dir + "/" + _name + pgmext_;
+    ifstream in(pgmname.c_str(), ios::binary);
+    if (!in.good())
+      throw GeographicErr("File not readable " + pgmname);
+    // Copy the comments from the header
+    ostringstream hdr;
+    hdr << nativeid_ << "\n";
+    string s;
+    if (!(getline(in, s) && s == "P5"))
+      throw GeographicErr("File not in PGM format " + pgmname);
+    int width = 0, height = 0;
+    while (getline(in, s)) {
+      if (s.empty() || s[0] == '#') {
+        if (!(s.compare(0, 9, "# Padding") == 0))
+          hdr << s << "\n";
+        continue;
+      }
+      istringstream is(s);
+      if (!(is >> width >> height))
+        throw GeographicErr("Error reading raster size " + pgmname);
+      break;
+    }
+    unsigned maxval;
+    if (!(in >> maxval && maxval == pixel_max_))
+      throw GeographicErr("Incorrect value of maxval " + pgmname);
+    // Add 1 for whitespace after maxval
+    unsigned long long datastart = (unsigned long long)(in.tellg()) + 1ULL;
+    in.seekg(0, ios::end);
+    if (!(width > 0 && height > 0 && in.good() &&
+          datastart + pixel_size_ * (unsigned long long)(width) *
+          (unsigned long long)(height) == (unsigned long long)(in.tellg())))
+      throw GeographicErr("File has the wrong length " + pgmname);
+    ostringstream tail;
+    tail << width << " " << height << "\n" << pixel_max_ << "\n";
+    // Pad the header with a comment so that the data is aligned
+    const size_t align = 64;
+    string pad("# Padding");
+    size_t len = hdr.str().size() + pad.size() + 1 + tail.str().size();
+    pad += string((align - len % align) % align, ' ');
+    // Write to a temporary file which is renamed on success, so that
+    // filename is never left truncated (and so that filename can be the file
+    // being read).
+    string tmpname = filename + ".tmp";
+    {
+      ofstream out(tmpname.c_str(), ios::binary);
+      if (!out.good())
+        throw GeographicErr("File not writable " + tmpname);
+      out << hdr.str() << pad << "\n" << tail.str();
+      in.seekg(streamoff(datastart));
+      vector<pixel_t> row(width);
+      try {
+        for (int iy = 0; iy < height; ++iy) {
+          Utility::readarray<pixel_t, pixel_t, true>(in, row);
+          Utility::writearray<pixel_t, pixel_t, false>(out, row);
+        }
+      }
+      catch (const exception& e) {
+        out.close();
+        remove(tmpname.c_str());
+        throw GeographicErr("Error converting " + pgmname + ": " + e.what());
+      }
+      out.close();
+      if (!out.good()) {
+        remove(tmpname.c_str());
+        throw GeographicErr("Error writing " + tmpname);
+      }
+    }
+    in.close();
+#if defined(_WIN32)
+    // rename doesn't replace an existing file on Windows
+    remove(filename.c_str());
+#endif
+    if (rename(tmpname.c_str(), filename.c_str()) != 0) {
+      remove(tmpname.c_str());
+      throw GeographicErr("Cannot rename " + tmpname + " to " + filename);
+    }
+  }
+
+  int Geoid::TileSize() const { return _tiles ? _tiles->_size : 0; }
+
+  size_t Geoid::TileBudget() const { return _tiles ? _tiles->_budget : 0; }
+
+  size_t Geoid::TileCount() const { return _tiles ? _tiles->_tiles.size() : 0; }
+
+  unsigned long long Geoid::TileHits() const
+  { return _tiles ? _tiles->_hits : 0; }
+
+  unsigned long long Geoid::TileMisses() const
+  { return _tiles ? _tiles->_misses : 0; }
+
+  unsigned long long Geoid::TilePrefetches() const
+  { return _tiles ? _tiles->prefetches() : 0; }
+
   std::string Geoid::DefaultGeoidPath() {
     string path;
     char* geoidpath = getenv("GEOGRAPHICLIB_GEOID_PATH");
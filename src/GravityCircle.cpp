@@ -46,6 +46,24 @@ namespace geographic_lib {
     return T/_gamma0 + correction;
   }
 
+  void GravityCircle::GeoidHeight(real lon0, real dlon, size_t n, real N[])
+    const {
+    if ((_caps & GEOID_HEIGHT) != GEOID_HEIGHT) {
+      for (size_t j = 0; j < n; ++j)
+        N[j] = Math::NaN();
+      return;
+    }
+    vector<real> correction(n);
+    _disturbing.Values(lon0, dlon, n, N);
+    if (n)
+      _correction.Values(lon0, dlon, n, &correction[0]);
+    for (size_t j = 0; j < n; ++j) {
+      // As in InternalT (with correct = false)
+      real T = N[j] / _amodel * _GMmodel;
+      N[j] = T/_gamma0 + _corrmult * correction[j];
+    }
+  }
+
   void GravityCircle::SphericalAnomaly(real lon,
                                        real& Dg01, real& xi, real& eta) const {
     if ((_caps & SPHERICAL_ANOMALY) != SPHERICAL_ANOMALY) {
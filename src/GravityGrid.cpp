@@ -0,0 +1,265 @@
+/**
+ * \file GravityGrid.cpp
+ * \brief Implementation for geographic_lib::GravityGrid class
+ *
+ * Copyright (c) 2026 the geographic_lib authors and licensed under the
+ * MIT/X11 License.  This file is not part of the upstream GeographicLib
+ * distribution; see https://geographiclib.sourceforge.io/ for that.
+ **********************************************************************/
+
+#include <fstream>
+#include <iomanip>
+#include <vector>
+#include <geographic_lib/GravityGrid.hpp>
+#include <geographic_lib/GravityModel.hpp>
+#include <geographic_lib/GravityCircle.hpp>
+#include <geographic_lib/Utility.hpp>
+
+#if defined(_OPENMP)
+#  include <omp.h>
+#elif GEOGRAPHICLIB_CXX11_THREADS
+#  include <chrono>
+#else
+#  include <ctime>
+#endif
+
+namespace geographic_lib {
+
+  using namespace std;
+
+  GravityGrid::GravityGrid(const GravityModel& model, quantity q,
+                           real south, real west, real dlat, real dlon,
+                           int nlat, int nlon, real h)
+    : _model(model)
+    , _quantity(unsigned(q))
+    , _south(south)
+    , _west(west)
+    , _dlat(dlat)
+    , _dlon(dlon)
+    , _h(h)
+    , _nlat(nlat)
+    , _nlon(nlon)
+    , _latdeg(perdegree(dlat))
+    , _londeg(perdegree(dlon))
+  {
+    if (!(_quantity <= ANOMALY))
+      throw GeographicErr("Unknown quantity for GravityGrid");
+    if (!(_dlat > 0 && _dlon > 0))
+      throw GeographicErr("Grid spacings are not positive");
+    if (!(_nlat > 0 && _nlon > 0))
+      throw GeographicErr("Grid dimensions are not positive");
+    // Allow for roundoff in the position of the northern row
+    real eps = 360 * numeric_limits<real>::epsilon();
+    if (!(_south >= -90 && latitude(_nlat - 1) <= 90 + eps))
+      throw GeographicErr("Grid extends beyond the poles");
+    if (!Math::isfinite(_west))
+      throw GeographicErr("Western longitude is not finite");
+  }
+
+  int GravityGrid::perdegree(real d) {
+    // If d = 1/n for an integer n, return n.  However, if n is a power of 2,
+    // d is exact and j * d is already exact, so return 0.
+    if (!(d > 0 && d <= 1))
+      return 0;
+    real x = 1 / d;
+    if (!(x < real(numeric_limits<int>::max())))
+      return 0;
+    int n = int(floor(x + real(0.5)));
+    return 1 / real(n) == d && (n & (n - 1)) != 0 ? n : 0;
+  }
+
+  int GravityGrid::MaxThreads() {
+#if defined(_OPENMP)
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+  }
+
+  double GravityGrid::wallclock() {
+#if defined(_OPENMP)
+    return omp_get_wtime();
+#elif GEOGRAPHICLIB_CXX11_THREADS
+    return chrono::duration<double>(chrono::steady_clock::now()
+                                    .time_since_epoch()).count();
+#else
+    return double(time(0));
+#endif
+  }
+
+  int GravityGrid::batchrows() const {
+    // Enough rows to keep all the threads busy, but limit the memory used to
+    // hold a batch to about 64 MB.
+    int n = 4 * MaxThreads(),
+      m = int(max(size_t(1), (size_t(1) << 26) /
+                  (size_t(_nlon) * sizeof(real))));
+    return min(n, m);
+  }
+
+  void GravityGrid::row(int i, real vals[]) const {
+    real lat = min(real(90), latitude(i));
+    unsigned caps = _quantity == GEOID_HEIGHT ? GravityModel::GEOID_HEIGHT :
+      (_quantity == DISTURBANCE ? GravityModel::DISTURBANCE :
+       GravityModel::SPHERICAL_ANOMALY);
+    GravityCircle c(_model.Circle(lat, _quantity == GEOID_HEIGHT ? 0 : _h,
+                                  caps));
+    if (_quantity == GEOID_HEIGHT) {
+      if (_londeg)
+        // Evaluate the row a degree at a time so that the longitudes match
+        // longitude(j)
+        for (int j = 0; j < _nlon; j += _londeg)
+          c.GeoidHeight(longitude(j), _dlon, size_t(min(_londeg, _nlon - j)),
+                        vals + j);
+      else
+        // Evaluate the whole row at once
+        c.GeoidHeight(_west, _dlon, size_t(_nlon), vals);
+      return;
+    }
+    for (int j = 0; j < _nlon; ++j) {
+      real lon = longitude(j), v, t1, t2, t3;
+      if (_quantity == DISTURBANCE) {
+        c.Disturbance(lon, t1, t2, t3);
+        v = -t3;
+      } else
+        c.SphericalAnomaly(lon, v, t1, t2);
+      vals[j] = v;
+    }
+  }
+
+  void GravityGrid::Rows(int i0, int n, real vals[]) const {
+    if (!(i0 >= 0 && n >= 0 && i0 + n <= _nlat))
+      throw GeographicErr("Rows out of range for GravityGrid");
+    // With mpreal, the precision must be set in each thread
+    int ndigits = Math::digits();
+    // Rows near the poles are no cheaper than those near the equator, but
+    // a dynamic schedule copes with threads being descheduled.
+#if defined(_OPENMP)
+#  pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < n; ++i) {
+      Math::set_digits(ndigits);
+      row(i0 + i, vals + size_t(i) * size_t(_nlon));
+    }
+  }
+
+  void GravityGrid::writerows(ostream& str, bool northfirst, encoding enc,
+                              real offset, real scale, ostream* log) const {
+    int nb = batchrows();
+    vector<real> vals(size_t(nb) * size_t(_nlon));
+    vector<unsigned short> pix(enc == GTXFLOAT_ ? 0 : _nlon);
+    vector<float> flt(enc == GTXFLOAT_ ? _nlon : 0);
+    unsigned long long clamped = 0;
+    double start = wallclock(), last = start;
+    for (int k = 0; k < _nlat; k += nb) {
+      int n = min(nb, _nlat - k),
+        i0 = northfirst ? _nlat - k - n : k;
+      Rows(i0, n, &vals[0]);
+      for (int r = 0; r < n; ++r) {
+        const real* v = &vals[size_t(northfirst ? n - 1 - r : r) *
+                              size_t(_nlon)];
+        if (enc == GTXFLOAT_) {
+          for (int j = 0; j < _nlon; ++j)
+            flt[j] = float(v[j]);
+          Utility::writearray<float, float, true>(str, flt);
+        } else {
+          for (int j = 0; j < _nlon; ++j) {
+            real p = floor((v[j] - offset) / scale + real(0.5));
+            if (!(p >= 0 && p <= 0xffff)) {
+              ++clamped;
+              p = p > 0 ? 0xffff : 0; // NaNs map to 0
+            }
+            pix[j] = (unsigned short)(p);
+          }
+          if (enc == PGMBIG_)
+            Utility::writearray<unsigned short, unsigned short, true>
+              (str, pix);
+          else
+            Utility::writearray<unsigned short, unsigned short, false>
+              (str, pix);
+        }
+      }
+      if (!str.good())
+        throw GeographicErr("Error writing grid");
+      int done = k + n;
+      double now = log ? wallclock() : 0;
+      // Report at most once a second (and at the end)
+      if (log && (now - last >= 1 || done == _nlat)) {
+        last = now;
+        double t = now - start,
+          rate = t > 0 ? double(done) * double(_nlon) / t : 0;
+        ios::fmtflags f = log->flags();
+        *log << "GravityGrid: " << done << "/" << _nlat << " rows, "
+             << fixed << setprecision(1) << t << " s, "
+             << scientific << setprecision(3) << rate << " points/s";
+        if (done < _nlat && done > 0)
+          *log << ", ETA " << fixed << setprecision(0)
+               << t * (_nlat - done) / done << " s";
+        *log << "\n" << flush;
+        log->flags(f);
+      }
+    }
+    if (log && enc != GTXFLOAT_ && clamped)
+      *log << "GravityGrid: " << clamped << " values out of range\n";
+  }
+
+  void GravityGrid::WritePGM(const std::string& filename,
+                             real offset, real scale, bool native,
+                             std::ostream* log) const {
+    if (!(scale > 0))
+      throw GeographicErr("Scale must be positive");
+    ofstream str(filename.c_str(), ios::binary);
+    if (!str.good())
+      throw GeographicErr("File not writable " + filename);
+    static const char* const names[] =
+      {"geoid height", "gravity disturbance", "gravity anomaly"};
+    ostringstream hdr;
+    // Enough precision to specify offset and scale exactly, but no more so
+    // that, e.g., 0.003 isn't written as 0.0030000000000000001.
+    hdr << setprecision(15);
+    // The header for the native format is described in Geoid::WriteNative
+    hdr << (native ? "GEOID-LE" : "P5") << "\n"
+        << "# Description " << _model.Description() << ", "
+        << names[_quantity] << "\n"
+        << "# DateTime " << _model.DateTime() << "\n"
+        << "# Offset " << offset << "\n"
+        << "# Scale " << scale << "\n";
+    {
+      real north = latitude(_nlat - 1);
+      hdr << "# Origin "
+          << fabs(north) << (north < 0 ? "S " : "N ")
+          << fabs(_west) << (_west < 0 ? "W" : "E") << "\n"
+          << "# AREA_OR_POINT Point\n";
+    }
+    ostringstream tail;
+    tail << _nlon << " " << _nlat << "\n" << 0xffff << "\n";
+    if (native) {
+      // Pad the header so that the data is aligned
+      const size_t align = 64;
+      string pad("# Padding");
+      size_t len = hdr.str().size() + pad.size() + 1 + tail.str().size();
+      pad += string((align - len % align) % align, ' ');
+      hdr << pad << "\n";
+    }
+    str << hdr.str() << tail.str();
+    writerows(str, true, native ? PGMLITTLE_ : PGMBIG_, offset, scale, log);
+    str.close();
+    if (!str.good())
+      throw GeographicErr("Error writing " + filename);
+  }
+
+  void GravityGrid::WriteGTX(const std::string& filename,
+                             std::ostream* log) const {
+    ofstream str(filename.c_str(), ios::binary);
+    if (!str.good())
+      throw GeographicErr("File not writable " + filename);
+    real transform[] = {_south, _west, _dlat, _dlon};
+    int sizes[] = {_nlat, _nlon};
+    Utility::writearray<double, real, true>(str, transform, 4);
+    Utility::writearray<int, int, true>(str, sizes, 2);
+    writerows(str, false, GTXFLOAT_, 0, 1, log);
+    str.close();
+    if (!str.good())
+      throw GeographicErr("Error writing " + filename);
+  }
+
+} // namespace geographic_lib
@@ -201,14 +201,24 @@ namespace geographic_lib {
     // If correct, then produce the correct T = W - U.  Otherwise, neglect the
     // n = 0 term (which is proportial to the difference in the model and
     // reference values of GM).
-    if (_dzonal0 == 0)
-      // No need to do the correction
-      correct = false;
-    real T, invR = correct ? 1 / Math::hypot(Math::hypot(X, Y), Z) : 1;
+    real T;
     if (gradp) {
       // initial values to suppress warnings
       deltaX = deltaY = deltaZ = 0;
       T = _disturbing(-1, X, Y, Z, deltaX, deltaY, deltaZ);
+    } else
+      T = _disturbing(-1, X, Y, Z);
+    return FinishT(X, Y, Z, T, deltaX, deltaY, deltaZ, gradp, correct);
+  }
+
+  Math::real GravityModel::FinishT(real X, real Y, real Z, real T,
+                                   real& deltaX, real& deltaY, real& deltaZ,
+                                   bool gradp, bool correct) const {
+    if (_dzonal0 == 0)
+      // No need to do the correction
+      correct = false;
+    real invR = correct ? 1 / Math::hypot(Math::hypot(X, Y), Z) : 1;
+    if (gradp) {
       real f = _GMmodel / _amodel;
       deltaX *= f;
       deltaY *= f;
@@ -219,8 +229,7 @@ namespace geographic_lib {
         deltaY += Y * invR;
         deltaZ += Z * invR;
       }
-    } else
-      T = _disturbing(-1, X, Y, Z);
+    }
     T = (T / _amodel - (correct ? _dzonal0 : 0) * invR) * _GMmodel;
     return T;
   }
@@ -304,6 +313,33 @@ namespace geographic_lib {
     return Tres;
   }
 
+  void GravityModel::Disturbance(size_t n, const real lat[], const real lon[],
+                                 const real h[], real deltax[], real deltay[],
+                                 real deltaz[], real T[]) const {
+    // Process the points in batches to bound the scratch space needed for
+    // the geocentric coordinates and rotation matrices.
+    const size_t batch = 256;
+    vector<real> X(min(n, batch)), Y(X.size()), Z(X.size()),
+      M(X.size() * Geocentric::dim2_);
+    for (size_t i0 = 0; i0 < n; i0 += batch) {
+      size_t l = min(n - i0, batch);
+      for (size_t k = 0; k < l; ++k)
+        _earth.Earth().IntForward(lat[i0 + k], lon[i0 + k], h[i0 + k],
+                                  X[k], Y[k], Z[k],
+                                  &M[k * Geocentric::dim2_]);
+      _disturbing(-1, l, &X[0], &Y[0], &Z[0], T + i0,
+                  deltax + i0, deltay + i0, deltaz + i0);
+      for (size_t k = 0; k < l; ++k) {
+        size_t i = i0 + k;
+        T[i] = FinishT(X[k], Y[k], Z[k], T[i],
+                       deltax[i], deltay[i], deltaz[i], true, true);
+        Geocentric::Unrotate(&M[k * Geocentric::dim2_],
+                             deltax[i], deltay[i], deltaz[i],
+                             deltax[i], deltay[i], deltaz[i]);
+      }
+    }
+  }
+
   GravityCircle GravityModel::Circle(real lat, real h, unsigned caps) const {
     if (h != 0)
       // Disallow invoking GeoidHeight unless h is zero.
@@ -11,6 +11,7 @@
 #include <fstream>
 #include <geographic_lib/SphericalEngine.hpp>
 #include <geographic_lib/MagneticCircle.hpp>
+#include <geographic_lib/MagneticSnapshot.hpp>
 #include <geographic_lib/Utility.hpp>
 
 #if !defined(GEOGRAPHICLIB_DATA)
@@ -81,6 +82,52 @@ namespace geographic_lib {
       if (pos != coeffstr.tellg())
         throw GeographicErr("Extra data in " + coeff);
     }
+    // Set up the sums used by Field.  In the time interval starting with
+    // model n, the field is given by model n + t * rate (+ the constant
+    // terms), where the rate is the difference of models n + 1 and n divided
+    // by _dt0 or, for the last interval, the secular variation.  The first
+    // two terms are evaluated with a single traversal of the recursion using
+    // SphericalHarmonic1; this requires that the first set of coefficients
+    // has the larger degree and order, so pad model n with zeros as needed.
+    // The constant terms (typically a crustal field of much higher degree)
+    // are summed separately.
+    _Gt.resize(_Nmodels); _Ht.resize(_Nmodels);
+    _Gb.resize(_Nmodels); _Hb.resize(_Nmodels);
+    for (int n = 0; n < _Nmodels; ++n) {
+      const SphericalEngine::coeff& c0 = _harm[n].Coefficients();
+      const SphericalEngine::coeff& c1 = _harm[n + 1].Coefficients();
+      bool interpolate = n + 1 < _Nmodels;
+      int N = interpolate ? max(c0.N(), c1.N()) : c1.N(),
+        M = interpolate ? max(c0.mmx(), c1.mmx()) : c1.mmx();
+      _Gt[n].resize(SphericalEngine::coeff::Csize(N, M));
+      _Ht[n].resize(SphericalEngine::coeff::Ssize(N, M));
+      addcoeffs(1, c1, N, M, _Gt[n], _Ht[n]);
+      if (interpolate) {
+        addcoeffs(-1, c0, N, M, _Gt[n], _Ht[n]);
+        for (size_t k = 0; k < _Gt[n].size(); ++k) _Gt[n][k] /= _dt0;
+        for (size_t k = 0; k < _Ht[n].size(); ++k) _Ht[n][k] /= _dt0;
+      }
+      _harmt.push_back(SphericalHarmonic(_Gt[n], _Ht[n], N, N, M, _a, _norm));
+      int Nb = max(c0.N(), N), Mb = max(c0.mmx(), M);
+      _Gb[n].resize(SphericalEngine::coeff::Csize(Nb, Mb));
+      _Hb[n].resize(SphericalEngine::coeff::Ssize(Nb, Mb));
+      addcoeffs(1, c0, Nb, Mb, _Gb[n], _Hb[n]);
+      _harm1.push_back(SphericalHarmonic1(_Gb[n], _Hb[n], Nb, Nb, Mb,
+                                          _Gt[n], _Ht[n], N, N, M,
+                                          _a, _norm));
+    }
+  }
+
+  void MagneticModel::addcoeffs(real f, const SphericalEngine::coeff& c,
+                                int N, int M, vector<real>& C, vector<real>& S)
+  {
+    for (int m = 0; m <= min(M, c.mmx()); ++m)
+      for (int n = m; n <= min(N, c.nmx()); ++n) {
+        int k = c.index(n, m), l = m * N - m * (m - 1) / 2 + n;
+        C[l] += f * c.Cv(k);
+        if (m)
+          S[l - (N + 1)] += f * c.Sv(k);
+      }
   }
 
   void MagneticModel::ReadMetadata(const std::string& name) {
@@ -175,7 +222,6 @@ namespace geographic_lib {
                             real& Bxt, real& Byt, real& Bzt) const {
     t -= _t0;
     int n = max(min(int(floor(t / _dt0)), _Nmodels - 1), 0);
-    bool interpolate = n + 1 < _Nmodels;
     t -= n * _dt0;
     real X, Y, Z;
     real M[Geocentric::dim2_];
@@ -183,26 +229,30 @@ namespace geographic_lib {
     // Components in geocentric basis
     // initial values to suppress warning
     real BX0 = 0, BY0 = 0, BZ0 = 0, BX1 = 0, BY1 = 0, BZ1 = 0;
-    real BXc = 0, BYc = 0, BZc = 0;
-    _harm[n](X, Y, Z, BX0, BY0, BZ0);
-    _harm[n + 1](X, Y, Z, BX1, BY1, BZ1);
-    if (_Nconstants)
-      _harm[_Nmodels + 1](X, Y, Z, BXc, BYc, BZc);
-    if (interpolate) {
-      // Convert to a time derivative
-      BX1 = (BX1 - BX0) / _dt0;
-      BY1 = (BY1 - BY0) / _dt0;
-      BZ1 = (BZ1 - BZ0) / _dt0;
-    }
-    BX0 += t * BX1 + BXc;
-    BY0 += t * BY1 + BYc;
-    BZ0 += t * BZ1 + BZc;
-    if (diffp) {
+    if (!diffp)
+      // Interpolate (or extrapolate) the coefficients in time so that the
+      // time-dependent part of the field is given by a single sum
+      _harm1[n](t, X, Y, Z, BX0, BY0, BZ0);
+    else {
+      // The rate of change of the field is needed anyway, so sum the base
+      // and rate terms separately
+      _harm[n](X, Y, Z, BX0, BY0, BZ0);
+      _harmt[n](X, Y, Z, BX1, BY1, BZ1);
+      BX0 += t * BX1;
+      BY0 += t * BY1;
+      BZ0 += t * BZ1;
       Geocentric::Unrotate(M, BX1, BY1, BZ1, Bxt, Byt, Bzt);
       Bxt *= - _a;
       Byt *= - _a;
       Bzt *= - _a;
     }
+    if (_Nconstants) {
+      real BXc = 0, BYc = 0, BZc = 0;
+      _harm[_Nmodels + 1](X, Y, Z, BXc, BYc, BZc);
+      BX0 += BXc;
+      BY0 += BYc;
+      BZ0 += BZc;
+    }
     Geocentric::Unrotate(M, BX0, BY0, BZ0, Bx, By, Bz);
     Bx *= - _a;
     By *= - _a;
@@ -230,6 +280,30 @@ namespace geographic_lib {
                            _harm[_Nmodels + 1].Circle(X, Z, true)));
   }
 
+  MagneticSnapshot MagneticModel::AtTime(real t) const {
+    real t1 = t - _t0;
+    int n = max(min(int(floor(t1 / _dt0)), _Nmodels - 1), 0);
+    t1 -= n * _dt0;
+    // Form model n + t1 * rate (+ the constant terms)
+    const SphericalEngine::coeff& c0 = _harm[n].Coefficients();
+    const SphericalEngine::coeff& ct = _harmt[n].Coefficients();
+    int N = max(c0.N(), ct.N()), M = max(c0.mmx(), ct.mmx());
+    if (_Nconstants) {
+      const SphericalEngine::coeff& cc = _harm[_Nmodels + 1].Coefficients();
+      N = max(N, cc.N()); M = max(M, cc.mmx());
+    }
+    vector<real>
+      G(SphericalEngine::coeff::Csize(N, M)),
+      H(SphericalEngine::coeff::Ssize(N, M)),
+      Gt(_Gt[n]), Ht(_Ht[n]);
+    addcoeffs(1, c0, N, M, G, H);
+    addcoeffs(t1, ct, N, M, G, H);
+    if (_Nconstants)
+      addcoeffs(1, _harm[_Nmodels + 1].Coefficients(), N, M, G, H);
+    return MagneticSnapshot(_a, _earth, t, N, M, G, H,
+                            ct.N(), ct.mmx(), Gt, Ht, _norm);
+  }
+
   void MagneticModel::FieldComponents(real Bx, real By, real Bz,
                                       real Bxt, real Byt, real Bzt,
                                       real& H, real& F, real& D, real& I,
@@ -0,0 +1,98 @@
+/**
+ * \file MagneticSnapshot.cpp
+ * \brief Implementation for geographic_lib::MagneticSnapshot class
+ *
+ * Copyright (c) 2026 the geographic_lib authors and licensed under the
+ * MIT/X11 License.  This file is not part of the upstream GeographicLib
+ * distribution; see https://geographiclib.sourceforge.io/ for that.
+ **********************************************************************/
+
+#include <geographic_lib/MagneticSnapshot.hpp>
+
+namespace geographic_lib {
+
+  using namespace std;
+
+  MagneticSnapshot::MagneticSnapshot(real a, const Geocentric& earth, real t,
+                                     int N, int M,
+                                     std::vector<real>& G,
+                                     std::vector<real>& H,
+                                     int Nt, int Mt,
+                                     std::vector<real>& Gt,
+                                     std::vector<real>& Ht,
+                                     SphericalHarmonic::normalization norm)
+    : _a(a)
+    , _t(t)
+    , _earth(earth)
+    , _N(N)
+    , _M(M)
+    , _Nt(Nt)
+    , _Mt(Mt)
+    , _norm(norm)
+  {
+    _G.swap(G); _H.swap(H);
+    _Gt.swap(Gt); _Ht.swap(Ht);
+    reset();
+  }
+
+  MagneticSnapshot::MagneticSnapshot(const MagneticSnapshot& s)
+    : _a(s._a)
+    , _t(s._t)
+    , _earth(s._earth)
+    , _N(s._N)
+    , _M(s._M)
+    , _Nt(s._Nt)
+    , _Mt(s._Mt)
+    , _norm(s._norm)
+    , _G(s._G)
+    , _H(s._H)
+    , _Gt(s._Gt)
+    , _Ht(s._Ht)
+  {
+    reset();
+  }
+
+  MagneticSnapshot& MagneticSnapshot::operator=(const MagneticSnapshot& s) {
+    if (this != &s) {
+      _a = s._a; _t = s._t; _earth = s._earth;
+      _N = s._N; _M = s._M; _Nt = s._Nt; _Mt = s._Mt;
+      _norm = s._norm;
+      _G = s._G; _H = s._H; _Gt = s._Gt; _Ht = s._Ht;
+      reset();
+    }
+    return *this;
+  }
+
+  void MagneticSnapshot::reset() {
+    if (Init()) {
+      _harm = SphericalHarmonic(_G, _H, _N, _N, _M, _a, _norm);
+      _harmt = SphericalHarmonic(_Gt, _Ht, _Nt, _Nt, _Mt, _a, _norm);
+    } else {
+      _harm = SphericalHarmonic();
+      _harmt = SphericalHarmonic();
+    }
+  }
+
+  void MagneticSnapshot::Field(real lat, real lon, real h, bool diffp,
+                               real& Bx, real& By, real& Bz,
+                               real& Bxt, real& Byt, real& Bzt) const {
+    real X, Y, Z;
+    real M[Geocentric::dim2_];
+    _earth.IntForward(lat, lon, h, X, Y, Z, M);
+    // Components in geocentric basis
+    real BX0, BY0, BZ0, BX1, BY1, BZ1;
+    _harm(X, Y, Z, BX0, BY0, BZ0);
+    if (diffp) {
+      _harmt(X, Y, Z, BX1, BY1, BZ1);
+      Geocentric::Unrotate(M, BX1, BY1, BZ1, Bxt, Byt, Bzt);
+      Bxt *= - _a;
+      Byt *= - _a;
+      Bzt *= - _a;
+    }
+    Geocentric::Unrotate(M, BX0, BY0, BZ0, Bx, By, Bz);
+    Bx *= - _a;
+    By *= - _a;
+    Bz *= - _a;
+  }
+
+} // namespace geographic_lib
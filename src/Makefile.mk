@@ -20,20 +20,24 @@ MODULES = Accumulator \
 	GeoCoords \
 	Geocentric \
 	Geodesic \
+	GeodesicDistanceMatrix \
 	GeodesicExact \
 	GeodesicLine \
+	GeodesicLineChebyshev \
 	GeodesicLineExact \
 	Geohash \
 	Geoid \
 	Georef \
 	Gnomonic \
 	GravityCircle \
+	GravityGrid \
 	GravityModel \
 	LambertConformalConic \
 	LocalCartesian \
 	MGRS \
 	MagneticCircle \
 	MagneticModel \
+	MagneticSnapshot \
 	Math \
 	NormalGravity \
 	OSGB \
@@ -95,11 +99,17 @@ GARS.o: Config.h Constants.hpp GARS.hpp Utility.hpp
 GeoCoords.o: Config.h Constants.hpp DMS.hpp GeoCoords.hpp MGRS.hpp Math.hpp \
 	UTMUPS.hpp Utility.hpp
 Geocentric.o: Config.h Constants.hpp Geocentric.hpp Math.hpp
-Geodesic.o: Config.h Constants.hpp Geodesic.hpp GeodesicLine.hpp Math.hpp
+Geodesic.o: Config.h Constants.hpp Geodesic.hpp GeodesicLine.hpp \
+	GeodesicStatistics.hpp Math.hpp
+GeodesicDistanceMatrix.o: Config.h Constants.hpp Geodesic.hpp \
+	GeodesicDistanceMatrix.hpp Math.hpp
 GeodesicExact.o: Config.h Constants.hpp GeodesicExact.hpp \
-	GeodesicLineExact.hpp Math.hpp
-GeodesicExactC4.o: Config.h Constants.hpp GeodesicExact.hpp Math.hpp
+	GeodesicLineExact.hpp GeodesicStatistics.hpp Math.hpp
+GeodesicExactC4.o: Config.h Constants.hpp GeodesicExact.hpp \
+	GeodesicStatistics.hpp Math.hpp
 GeodesicLine.o: Config.h Constants.hpp Geodesic.hpp GeodesicLine.hpp Math.hpp
+GeodesicLineChebyshev.o: Config.h Constants.hpp GeodesicLine.hpp \
+	GeodesicLineChebyshev.hpp Geodesic.hpp Math.hpp Utility.hpp
 GeodesicLineExact.o: Config.h Constants.hpp GeodesicExact.hpp \
 	GeodesicLineExact.hpp Math.hpp
 Geohash.o: Config.h Constants.hpp Geohash.hpp Utility.hpp
@@ -110,6 +120,10 @@ Gnomonic.o: Config.h Constants.hpp Geodesic.hpp GeodesicLine.hpp Gnomonic.hpp \
 GravityCircle.o: CircularEngine.hpp Config.h Constants.hpp Geocentric.hpp \
 	GravityCircle.hpp GravityModel.hpp Math.hpp NormalGravity.hpp \
 	SphericalEngine.hpp SphericalHarmonic.hpp SphericalHarmonic1.hpp
+GravityGrid.o: CircularEngine.hpp Config.h Constants.hpp Geocentric.hpp \
+	GravityCircle.hpp GravityGrid.hpp GravityModel.hpp Math.hpp \
+	NormalGravity.hpp SphericalEngine.hpp SphericalHarmonic.hpp \
+	SphericalHarmonic1.hpp Utility.hpp
 GravityModel.o: CircularEngine.hpp Config.h Constants.hpp Geocentric.hpp \
 	GravityCircle.hpp GravityModel.hpp Math.hpp NormalGravity.hpp \
 	SphericalEngine.hpp SphericalHarmonic.hpp SphericalHarmonic1.hpp \
@@ -122,8 +136,11 @@ MGRS.o: Config.h Constants.hpp MGRS.hpp Math.hpp UTMUPS.hpp Utility.hpp
 MagneticCircle.o: CircularEngine.hpp Config.h Constants.hpp Geocentric.hpp \
 	MagneticCircle.hpp Math.hpp SphericalEngine.hpp
 MagneticModel.o: CircularEngine.hpp Config.h Constants.hpp Geocentric.hpp \
-	MagneticCircle.hpp MagneticModel.hpp Math.hpp SphericalEngine.hpp \
-	SphericalHarmonic.hpp Utility.hpp
+	MagneticCircle.hpp MagneticModel.hpp MagneticSnapshot.hpp Math.hpp \
+	SphericalEngine.hpp SphericalHarmonic.hpp SphericalHarmonic1.hpp \
+	Utility.hpp
+MagneticSnapshot.o: CircularEngine.hpp Config.h Constants.hpp Geocentric.hpp \
+	MagneticSnapshot.hpp Math.hpp SphericalEngine.hpp SphericalHarmonic.hpp
 Math.o: Config.h Constants.hpp Math.hpp
 NormalGravity.o: Config.h Constants.hpp Geocentric.hpp Math.hpp \
 	NormalGravity.hpp
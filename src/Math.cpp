@@ -58,6 +58,11 @@ namespace geographic_lib {
   template Math::real Math::eatanhe<Math::real>(Math::real, Math::real);
   template Math::real Math::taupf<Math::real>(Math::real, Math::real);
   template Math::real Math::tauf<Math::real>(Math::real, Math::real);
+#if GEOGRAPHICLIB_PRECISION != 1
+  template float Math::eatanhe<float>(float, float);
+  template float Math::taupf<float>(float, float);
+  template float Math::tauf<float>(float, float);
+#endif
   /// \endcond
 
 } // namespace geographic_lib
@@ -140,6 +140,10 @@
 #  pragma warning (disable: 4127 4701)
 #endif
 
+#if defined(_OPENMP)
+#  include <omp.h>
+#endif
+
 namespace geographic_lib {
 
   using namespace std;
@@ -149,6 +153,88 @@ namespace geographic_lib {
     return sqrttable;
   }
 
+  int& SphericalEngine::paralleldegree() {
+    static int paralleldegree = -1;
+    return paralleldegree;
+  }
+
+  int SphericalEngine::MaxThreads() {
+#if defined(_OPENMP)
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+  }
+
+  bool SphericalEngine::parallel(int N) {
+#if defined(_OPENMP)
+    int N0 = paralleldegree();
+    return N0 >= 0 && N >= N0 && !omp_in_parallel() &&
+      omp_get_max_threads() > 1;
+#else
+    (void)N;
+    return false;
+#endif
+  }
+
+  template<bool gradp, SphericalEngine::normalization norm, int L>
+  void SphericalEngine::InnerSum(const coeff c[], const real f[], int m,
+                                 real q, real t, real u, real s[]) {
+    int N = c[0].nmx();
+    real q2 = Math::sq(q);
+    int k[L];
+    const vector<real>& root( sqrttable() );
+    // Initialize inner sum
+    real
+      wc  = 0, wc2  = 0, ws  = 0, ws2  = 0, // w [N - m + 1], w [N - m + 2]
+      wrc = 0, wrc2 = 0, wrs = 0, wrs2 = 0, // wr[N - m + 1], wr[N - m + 2]
+      wtc = 0, wtc2 = 0, wts = 0, wts2 = 0; // wt[N - m + 1], wt[N - m + 2]
+    for (int l = 0; l < L; ++l)
+      k[l] = c[l].index(N, m) + 1;
+    for (int n = N; n >= m; --n) {             // n = N .. m; l = N - m .. 0
+      real w, A, Ax, B, R;    // alpha[l], beta[l + 1]
+      switch (norm) {
+      case FULL:
+        w = root[2 * n + 1] / (root[n - m + 1] * root[n + m + 1]);
+        Ax = q * w * root[2 * n + 3];
+        A = t * Ax;
+        B = - q2 * root[2 * n + 5] /
+          (w * root[n - m + 2] * root[n + m + 2]);
+        break;
+      case SCHMIDT:
+        w = root[n - m + 1] * root[n + m + 1];
+        Ax = q * (2 * n + 1) / w;
+        A = t * Ax;
+        B = - q2 * w / (root[n - m + 2] * root[n + m + 2]);
+        break;
+      default: break;       // To suppress warning message from Visual Studio
+      }
+      R = c[0].Cv(--k[0]);
+      for (int l = 1; l < L; ++l)
+        R += c[l].Cv(--k[l], n, m, f[l]);
+      R *= scale();
+      w = A * wc + B * wc2 + R; wc2 = wc; wc = w;
+      if (gradp) {
+        w = A * wrc + B * wrc2 + (n + 1) * R; wrc2 = wrc; wrc = w;
+        w = A * wtc + B * wtc2 -  u*Ax * wc2; wtc2 = wtc; wtc = w;
+      }
+      if (m) {
+        R = c[0].Sv(k[0]);
+        for (int l = 1; l < L; ++l)
+          R += c[l].Sv(k[l], n, m, f[l]);
+        R *= scale();
+        w = A * ws + B * ws2 + R; ws2 = ws; ws = w;
+        if (gradp) {
+          w = A * wrs + B * wrs2 + (n + 1) * R; wrs2 = wrs; wrs = w;
+          w = A * wts + B * wts2 -  u*Ax * ws2; wts2 = wts; wts = w;
+        }
+      }
+    }
+    s[0] = wc ; s[1] = ws ;
+    s[2] = wrc; s[3] = wrs;
+    s[4] = wtc; s[5] = wts;
+  }
+
   template<bool gradp, SphericalEngine::normalization norm, int L>
   Math::real SphericalEngine::Value(const coeff c[], const real f[],
                                     real x, real y, real z, real a,
@@ -168,7 +254,6 @@ namespace geographic_lib {
       u = r != 0 ? max(p / r, eps()) : 1, // sin(theta); but avoid the pole
       q = a / r;
     real
-      q2 = Math::sq(q),
       uq = u * q,
       uq2 = Math::sq(uq),
       tu = t / u;
@@ -179,55 +264,32 @@ namespace geographic_lib {
     real vrc = 0, vrc2 = 0, vrs = 0, vrs2 = 0;   // vr[N + 1], vr[N + 2]
     real vtc = 0, vtc2 = 0, vts = 0, vts2 = 0;   // vt[N + 1], vt[N + 2]
     real vlc = 0, vlc2 = 0, vls = 0, vls2 = 0;   // vl[N + 1], vl[N + 2]
-    int k[L];
     const vector<real>& root( sqrttable() );
+    // In parallel mode, compute the inner sums for all m first
+    bool par = parallel(N);
+    vector<real> sums(par ? 6 * (M + 1) : 0);
+    if (par) {
+      // With mpreal, the precision must be set in each thread
+      int ndigits = Math::digits();
+      // The cost of an inner sum is proportional to N - m + 1
+#if defined(_OPENMP)
+#  pragma omp parallel for schedule(dynamic)
+#endif
+      for (int m = 0; m <= M; ++m) {
+        Math::set_digits(ndigits);
+        InnerSum<gradp, norm, L>(c, f, m, q, t, u, &sums[6 * m]);
+      }
+    }
     for (int m = M; m >= 0; --m) {   // m = M .. 0
-      // Initialize inner sum
+      real s[6];
+      if (par)
+        copy(sums.begin() + 6 * m, sums.begin() + 6 * (m + 1), s);
+      else
+        InnerSum<gradp, norm, L>(c, f, m, q, t, u, s);
       real
-        wc  = 0, wc2  = 0, ws  = 0, ws2  = 0, // w [N - m + 1], w [N - m + 2]
-        wrc = 0, wrc2 = 0, wrs = 0, wrs2 = 0, // wr[N - m + 1], wr[N - m + 2]
-        wtc = 0, wtc2 = 0, wts = 0, wts2 = 0; // wt[N - m + 1], wt[N - m + 2]
-      for (int l = 0; l < L; ++l)
-        k[l] = c[l].index(N, m) + 1;
-      for (int n = N; n >= m; --n) {             // n = N .. m; l = N - m .. 0
-        real w, A, Ax, B, R;    // alpha[l], beta[l + 1]
-        switch (norm) {
-        case FULL:
-          w = root[2 * n + 1] / (root[n - m + 1] * root[n + m + 1]);
-          Ax = q * w * root[2 * n + 3];
-          A = t * Ax;
-          B = - q2 * root[2 * n + 5] /
-            (w * root[n - m + 2] * root[n + m + 2]);
-          break;
-        case SCHMIDT:
-          w = root[n - m + 1] * root[n + m + 1];
-          Ax = q * (2 * n + 1) / w;
-          A = t * Ax;
-          B = - q2 * w / (root[n - m + 2] * root[n + m + 2]);
-          break;
-        default: break;       // To suppress warning message from Visual Studio
-        }
-        R = c[0].Cv(--k[0]);
-        for (int l = 1; l < L; ++l)
-          R += c[l].Cv(--k[l], n, m, f[l]);
-        R *= scale();
-        w = A * wc + B * wc2 + R; wc2 = wc; wc = w;
-        if (gradp) {
-          w = A * wrc + B * wrc2 + (n + 1) * R; wrc2 = wrc; wrc = w;
-          w = A * wtc + B * wtc2 -  u*Ax * wc2; wtc2 = wtc; wtc = w;
-        }
-        if (m) {
-          R = c[0].Sv(k[0]);
-          for (int l = 1; l < L; ++l)
-            R += c[l].Sv(k[l], n, m, f[l]);
-          R *= scale();
-          w = A * ws + B * ws2 + R; ws2 = ws; ws = w;
-          if (gradp) {
-            w = A * wrs + B * wrs2 + (n + 1) * R; wrs2 = wrs; wrs = w;
-            w = A * wts + B * wts2 -  u*Ax * ws2; wts2 = wts; wts = w;
-          }
-        }
-      }
+        wc  = s[0], ws  = s[1],
+        wrc = s[2], wrs = s[3],
+        wtc = s[4], wts = s[5];
       // Now Sc[m] = wc, Ss[m] = ws
       // Sc'[m] = wtc, Ss'[m] = wtc
       if (m) {
@@ -295,72 +357,224 @@ namespace geographic_lib {
   }
 
   template<bool gradp, SphericalEngine::normalization norm, int L>
-  CircularEngine SphericalEngine::Circle(const coeff c[], const real f[],
-                                         real p, real z, real a) {
-
+  void SphericalEngine::Values(const coeff c[], const real f[], size_t n,
+                               const real x[], const real y[], const real z[],
+                               real a, real v[],
+                               real gradx[], real grady[], real gradz[]) {
     GEOGRAPHICLIB_STATIC_ASSERT(L > 0, "L must be positive");
     GEOGRAPHICLIB_STATIC_ASSERT(norm == FULL || norm == SCHMIDT,
                                 "Unknown normalization");
-    int N = c[0].nmx(), M = c[0].mmx();
+    for (size_t i = 0; i < n; i += lanes_)
+      ValueBlock<gradp, norm, L>(c, f, int(min(n - i, size_t(lanes_))),
+                                 x + i, y + i, z + i, a, v + i,
+                                 gradp ? gradx + i : 0,
+                                 gradp ? grady + i : 0,
+                                 gradp ? gradz + i : 0);
+  }
 
+  template<bool gradp, SphericalEngine::normalization norm, int L>
+  void SphericalEngine::ValueBlock(const coeff c[], const real f[], int n,
+                                   const real x[], const real y[],
+                                   const real z[], real a, real v[],
+                                   real gradx[], real grady[], real gradz[]) {
+    // This is Value with each scalar which depends on the position replaced
+    // by an array over the lanes_ points of the block; see Value for
+    // comments on the algorithm.  If n < lanes_, the last point is
+    // duplicated to fill the block so that the loops over the points have a
+    // fixed length.
+    const int K = lanes_;
+    int N = c[0].nmx(), M = c[0].mmx();
+    real cl[K], sl[K], r[K], t[K], u[K], q[K], q2[K], uq[K], uq2[K], tu[K],
+      tq[K];
+    for (int i = 0; i < K; ++i) {
+      int j = min(i, n - 1);
+      real p = Math::hypot(x[j], y[j]);
+      cl[i] = p != 0 ? x[j] / p : 1;
+      sl[i] = p != 0 ? y[j] / p : 0;
+      r[i] = Math::hypot(z[j], p);
+      t[i] = r[i] != 0 ? z[j] / r[i] : 0;
+      u[i] = r[i] != 0 ? max(p / r[i], eps()) : 1;
+      q[i] = a / r[i];
+      q2[i] = Math::sq(q[i]);
+      uq[i] = u[i] * q[i];
+      uq2[i] = Math::sq(uq[i]);
+      tu[i] = t[i] / u[i];
+      tq[i] = t[i] * q[i];
+    }
     real
-      r = Math::hypot(z, p),
-      t = r != 0 ? z / r : 0,   // cos(theta); at origin, pick theta = pi/2
-      u = r != 0 ? max(p / r, eps()) : 1, // sin(theta); but avoid the pole
-      q = a / r;
-    real
-      q2 = Math::sq(q),
-      tu = t / u;
-    CircularEngine circ(M, gradp, norm, a, r, u, t);
+      vc [K], vc2 [K], vs [K], vs2 [K],
+      vrc[K], vrc2[K], vrs[K], vrs2[K],
+      vtc[K], vtc2[K], vts[K], vts2[K],
+      vlc[K], vlc2[K], vls[K], vls2[K];
+    for (int i = 0; i < K; ++i) {
+      vc [i] = vc2 [i] = vs [i] = vs2 [i] = 0;
+      vrc[i] = vrc2[i] = vrs[i] = vrs2[i] = 0;
+      vtc[i] = vtc2[i] = vts[i] = vts2[i] = 0;
+      vlc[i] = vlc2[i] = vls[i] = vls2[i] = 0;
+    }
     int k[L];
     const vector<real>& root( sqrttable() );
     for (int m = M; m >= 0; --m) {   // m = M .. 0
-      // Initialize inner sum
       real
-        wc  = 0, wc2  = 0, ws  = 0, ws2  = 0, // w [N - m + 1], w [N - m + 2]
-        wrc = 0, wrc2 = 0, wrs = 0, wrs2 = 0, // wr[N - m + 1], wr[N - m + 2]
-        wtc = 0, wtc2 = 0, wts = 0, wts2 = 0; // wt[N - m + 1], wt[N - m + 2]
+        wc [K], wc2 [K], ws [K], ws2 [K],
+        wrc[K], wrc2[K], wrs[K], wrs2[K],
+        wtc[K], wtc2[K], wts[K], wts2[K];
+      for (int i = 0; i < K; ++i) {
+        wc [i] = wc2 [i] = ws [i] = ws2 [i] = 0;
+        wrc[i] = wrc2[i] = wrs[i] = wrs2[i] = 0;
+        wtc[i] = wtc2[i] = wts[i] = wts2[i] = 0;
+      }
       for (int l = 0; l < L; ++l)
         k[l] = c[l].index(N, m) + 1;
-      for (int n = N; n >= m; --n) {             // n = N .. m; l = N - m .. 0
-        real w, A, Ax, B, R;    // alpha[l], beta[l + 1]
+      for (int nn = N; nn >= m; --nn) {        // n = N .. m
+        // alpha[l] = t * q * ax, beta[l + 1] = q2 * b
+        real w, ax, b, Rc, Rs;
         switch (norm) {
         case FULL:
-          w = root[2 * n + 1] / (root[n - m + 1] * root[n + m + 1]);
-          Ax = q * w * root[2 * n + 3];
-          A = t * Ax;
-          B = - q2 * root[2 * n + 5] /
-            (w * root[n - m + 2] * root[n + m + 2]);
+          w = root[2 * nn + 1] / (root[nn - m + 1] * root[nn + m + 1]);
+          ax = w * root[2 * nn + 3];
+          b = - root[2 * nn + 5] / (w * root[nn - m + 2] * root[nn + m + 2]);
           break;
         case SCHMIDT:
-          w = root[n - m + 1] * root[n + m + 1];
-          Ax = q * (2 * n + 1) / w;
-          A = t * Ax;
-          B = - q2 * w / (root[n - m + 2] * root[n + m + 2]);
+          w = root[nn - m + 1] * root[nn + m + 1];
+          ax = (2 * nn + 1) / w;
+          b = - w / (root[nn - m + 2] * root[nn + m + 2]);
           break;
         default: break;       // To suppress warning message from Visual Studio
         }
-        R = c[0].Cv(--k[0]);
+        Rc = c[0].Cv(--k[0]);
         for (int l = 1; l < L; ++l)
-          R += c[l].Cv(--k[l], n, m, f[l]);
-        R *= scale();
-        w = A * wc + B * wc2 + R; wc2 = wc; wc = w;
-        if (gradp) {
-          w = A * wrc + B * wrc2 + (n + 1) * R; wrc2 = wrc; wrc = w;
-          w = A * wtc + B * wtc2 -  u*Ax * wc2; wtc2 = wtc; wtc = w;
-        }
+          Rc += c[l].Cv(--k[l], nn, m, f[l]);
+        Rc *= scale();
+        Rs = 0;                 // The m = 0 terms of S aren't stored
         if (m) {
-          R = c[0].Sv(k[0]);
+          Rs = c[0].Sv(k[0]);
           for (int l = 1; l < L; ++l)
-            R += c[l].Sv(k[l], n, m, f[l]);
-          R *= scale();
-          w = A * ws + B * ws2 + R; ws2 = ws; ws = w;
+            Rs += c[l].Sv(k[l], nn, m, f[l]);
+          Rs *= scale();
+        }
+        real Rcn = (nn + 1) * Rc, Rsn = (nn + 1) * Rs;
+        for (int i = 0; i < K; ++i) {
+          real A = tq[i] * ax, B = q2[i] * b, y;
+          y = A * wc[i] + B * wc2[i] + Rc; wc2[i] = wc[i]; wc[i] = y;
+          y = A * ws[i] + B * ws2[i] + Rs; ws2[i] = ws[i]; ws[i] = y;
           if (gradp) {
-            w = A * wrs + B * wrs2 + (n + 1) * R; wrs2 = wrs; wrs = w;
-            w = A * wts + B * wts2 -  u*Ax * ws2; wts2 = wts; wts = w;
+            y = A * wrc[i] + B * wrc2[i] + Rcn; wrc2[i] = wrc[i]; wrc[i] = y;
+            y = A * wrs[i] + B * wrs2[i] + Rsn; wrs2[i] = wrs[i]; wrs[i] = y;
+            real uAx = uq[i] * ax;
+            y = A * wtc[i] + B * wtc2[i] - uAx * wc2[i];
+            wtc2[i] = wtc[i]; wtc[i] = y;
+            y = A * wts[i] + B * wts2[i] - uAx * ws2[i];
+            wts2[i] = wts[i]; wts[i] = y;
           }
         }
       }
+      if (m) {
+        // alpha[m] = cl * w * uq, beta[m + 1] = bv * uq2
+        real w, bv;
+        switch (norm) {
+        case FULL:
+          w = root[2] * root[2 * m + 3] / root[m + 1];
+          bv = - w * root[2 * m + 5] / (root[8] * root[m + 2]);
+          break;
+        case SCHMIDT:
+          w = root[2] * root[2 * m + 1] / root[m + 1];
+          bv = - w * root[2 * m + 3] / (root[8] * root[m + 2]);
+          break;
+        default: break;       // To suppress warning message from Visual Studio
+        }
+        for (int i = 0; i < K; ++i) {
+          real A = cl[i] * w * uq[i], B = bv * uq2[i], vv;
+          vv = A * vc [i] + B * vc2 [i] + wc [i]; vc2 [i] = vc [i]; vc [i] = vv;
+          vv = A * vs [i] + B * vs2 [i] + ws [i]; vs2 [i] = vs [i]; vs [i] = vv;
+          if (gradp) {
+            wtc[i] += m * tu[i] * wc[i]; wts[i] += m * tu[i] * ws[i];
+            vv = A * vrc[i] + B * vrc2[i] + wrc[i];
+            vrc2[i] = vrc[i]; vrc[i] = vv;
+            vv = A * vrs[i] + B * vrs2[i] + wrs[i];
+            vrs2[i] = vrs[i]; vrs[i] = vv;
+            vv = A * vtc[i] + B * vtc2[i] + wtc[i];
+            vtc2[i] = vtc[i]; vtc[i] = vv;
+            vv = A * vts[i] + B * vts2[i] + wts[i];
+            vts2[i] = vts[i]; vts[i] = vv;
+            vv = A * vlc[i] + B * vlc2[i] + m*ws[i];
+            vlc2[i] = vlc[i]; vlc[i] = vv;
+            vv = A * vls[i] + B * vls2[i] - m*wc[i];
+            vls2[i] = vls[i]; vls[i] = vv;
+          }
+        }
+      } else {
+        real A, B;
+        switch (norm) {
+        case FULL:
+          A = root[3];          // F[1]/(q*cl*uq) or F[1]/(q*sl*uq)
+          B = - root[15]/2;     // beta[1]/(q*uq2)
+          break;
+        case SCHMIDT:
+          A = 1;
+          B = - root[3]/2;
+          break;
+        default: break;       // To suppress warning message from Visual Studio
+        }
+        for (int i = 0; i < K; ++i) {
+          real Ai = A * uq[i], Bi = B * uq2[i], qs = q[i] / scale();
+          vc[i] = qs * (wc[i] + Ai * (cl[i] * vc[i] + sl[i] * vs[i]) +
+                        Bi * vc2[i]);
+          if (gradp) {
+            qs /= r[i];
+            vrc[i] = - qs * (wrc[i] + Ai * (cl[i] * vrc[i] + sl[i] * vrs[i])
+                             + Bi * vrc2[i]);
+            vtc[i] =   qs * (wtc[i] + Ai * (cl[i] * vtc[i] + sl[i] * vts[i])
+                             + Bi * vtc2[i]);
+            vlc[i] = qs / u[i] * (Ai * (cl[i] * vlc[i] + sl[i] * vls[i])
+                                  + Bi * vlc2[i]);
+          }
+        }
+      }
+    }
+
+    for (int i = 0; i < n; ++i) {
+      v[i] = vc[i];
+      if (gradp) {
+        gradx[i] = cl[i] * (u[i] * vrc[i] + t[i] * vtc[i]) - sl[i] * vlc[i];
+        grady[i] = sl[i] * (u[i] * vrc[i] + t[i] * vtc[i]) + cl[i] * vlc[i];
+        gradz[i] =          t[i] * vrc[i] - u[i] * vtc[i]                 ;
+      }
+    }
+  }
+
+  template<bool gradp, SphericalEngine::normalization norm, int L>
+  CircularEngine SphericalEngine::Circle(const coeff c[], const real f[],
+                                         real p, real z, real a) {
+
+    GEOGRAPHICLIB_STATIC_ASSERT(L > 0, "L must be positive");
+    GEOGRAPHICLIB_STATIC_ASSERT(norm == FULL || norm == SCHMIDT,
+                                "Unknown normalization");
+    int M = c[0].mmx();
+
+    real
+      r = Math::hypot(z, p),
+      t = r != 0 ? z / r : 0,   // cos(theta); at origin, pick theta = pi/2
+      u = r != 0 ? max(p / r, eps()) : 1, // sin(theta); but avoid the pole
+      q = a / r;
+    real tu = t / u;
+    CircularEngine circ(M, gradp, norm, a, r, u, t);
+    // In parallel mode, the inner sums for the various m are independent and
+    // SetCoeff(m, ...) writes distinct elements of circ.
+    // With mpreal, the precision must be set in each thread
+    int ndigits = Math::digits();
+#if defined(_OPENMP)
+    bool par = parallel(c[0].nmx());
+#  pragma omp parallel for schedule(dynamic) if (par)
+#endif
+    for (int m = M; m >= 0; --m) {   // m = M .. 0
+      Math::set_digits(ndigits);
+      real s[6];
+      InnerSum<gradp, norm, L>(c, f, m, q, t, u, s);
+      real
+        wc  = s[0], ws  = s[1],
+        wrc = s[2], wrs = s[3],
+        wtc = s[4], wts = s[5];
       if (!gradp)
         circ.SetCoeff(m, wc, ws);
       else {
@@ -441,6 +655,57 @@ namespace geographic_lib {
   SphericalEngine::Value<false, SphericalEngine::SCHMIDT, 3>
   (const coeff[], const real[], real, real, real, real, real&, real&, real&);
 
+  template void GEOGRAPHICLIB_EXPORT
+  SphericalEngine::Values<true, SphericalEngine::FULL, 1>
+  (const coeff[], const real[], size_t, const real[], const real[],
+   const real[], real, real[], real[], real[], real[]);
+  template void GEOGRAPHICLIB_EXPORT
+  SphericalEngine::Values<false, SphericalEngine::FULL, 1>
+  (const coeff[], const real[], size_t, const real[], const real[],
+   const real[], real, real[], real[], real[], real[]);
+  template void GEOGRAPHICLIB_EXPORT
+  SphericalEngine::Values<true, SphericalEngine::SCHMIDT, 1>
+  (const coeff[], const real[], size_t, const real[], const real[],
+   const real[], real, real[], real[], real[], real[]);
+  template void GEOGRAPHICLIB_EXPORT
+  SphericalEngine::Values<false, SphericalEngine::SCHMIDT, 1>
+  (const coeff[], const real[], size_t, const real[], const real[],
+   const real[], real, real[], real[], real[], real[]);
+
+  template void GEOGRAPHICLIB_EXPORT
+  SphericalEngine::Values<true, SphericalEngine::FULL, 2>
+  (const coeff[], const real[], size_t, const real[], const real[],
+   const real[], real, real[], real[], real[], real[]);
+  template void GEOGRAPHICLIB_EXPORT
+  SphericalEngine::Values<false, SphericalEngine::FULL, 2>
+  (const coeff[], const real[], size_t, const real[], const real[],
+   const real[], real, real[], real[], real[], real[]);
+  template void GEOGRAPHICLIB_EXPORT
+  SphericalEngine::Values<true, SphericalEngine::SCHMIDT, 2>
+  (const coeff[], const real[], size_t, const real[], const real[],
+   const real[], real, real[], real[], real[], real[]);
+  template void GEOGRAPHICLIB_EXPORT
+  SphericalEngine::Values<false, SphericalEngine::SCHMIDT, 2>
+  (const coeff[], const real[], size_t, const real[], const real[],
+   const real[], real, real[], real[], real[], real[]);
+
+  template void GEOGRAPHICLIB_EXPORT
+  SphericalEngine::Values<true, SphericalEngine::FULL, 3>
+  (const coeff[], const real[], size_t, const real[], const real[],
+   const real[], real, real[], real[], real[], real[]);
+  template void GEOGRAPHICLIB_EXPORT
+  SphericalEngine::Values<false, SphericalEngine::FULL, 3>
+  (const coeff[], const real[], size_t, const real[], const real[],
+   const real[], real, real[], real[], real[], real[]);
+  template void GEOGRAPHICLIB_EXPORT
+  SphericalEngine::Values<true, SphericalEngine::SCHMIDT, 3>
+  (const coeff[], const real[], size_t, const real[], const real[],
+   const real[], real, real[], real[], real[], real[]);
+  template void GEOGRAPHICLIB_EXPORT
+  SphericalEngine::Values<false, SphericalEngine::SCHMIDT, 3>
+  (const coeff[], const real[], size_t, const real[], const real[],
+   const real[], real, real[], real[], real[], real[]);
+
   template CircularEngine GEOGRAPHICLIB_EXPORT
   SphericalEngine::Circle<true, SphericalEngine::FULL, 1>
   (const coeff[], const real[], real, real, real);
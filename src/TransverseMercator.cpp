@@ -31,7 +31,9 @@
  * If the preprocessor variable GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER is set
  * to an integer between 4 and 8, then this specifies the order of the series
  * used for the forward and reverse transformations.  The default value is 6.
- * (The series accurate to 12th order is given in \ref tmseries.)
+ * (The series accurate to 12th order is given in \ref tmseries.)  This
+ * applies to TransverseMercator; TransverseMercatorF always uses 4th order
+ * series.
  **********************************************************************/
 
 #include <iostream>
@@ -42,7 +44,185 @@ namespace geographic_lib {
 
   using namespace std;
 
-  TransverseMercator::TransverseMercator(real a, real f, real k0)
+  // The coefficient arrays for each order N = TransverseMercatorOrder<T>::order
+  // are the static members coeff of partial specializations of class
+  // templates, e.g., TransverseMercatorAlpCoeff<T, N>.  (For b1, the second
+  // template parameter is floor(N/2).)  In this way, only the arrays for the
+  // orders in use are instantiated.
+
+  /// \cond SKIP
+#define GEOGRAPHICLIB_TRANSVERSEMERCATOR_COEFF(name, N)                 \
+  template<typename T> struct name<T, N> { static const T coeff[]; };   \
+  template<typename T> const T name<T, N>::coeff[] =
+  /// \endcond
+
+  // Generated by Maxima on 2015-05-14 22:55:13-04:00
+  template<typename T, int N> struct TransverseMercatorB1Coeff;
+  GEOGRAPHICLIB_TRANSVERSEMERCATOR_COEFF(TransverseMercatorB1Coeff, 2) {
+    // b1*(n+1), polynomial in n2 of order 2
+    1, 16, 64, 64,
+  };  // count = 4
+  GEOGRAPHICLIB_TRANSVERSEMERCATOR_COEFF(TransverseMercatorB1Coeff, 3) {
+    // b1*(n+1), polynomial in n2 of order 3
+    1, 4, 64, 256, 256,
+  };  // count = 5
+  GEOGRAPHICLIB_TRANSVERSEMERCATOR_COEFF(TransverseMercatorB1Coeff, 4) {
+    // b1*(n+1), polynomial in n2 of order 4
+    25, 64, 256, 4096, 16384, 16384,
+  };  // count = 6
+  template<typename T, int N> struct TransverseMercatorAlpCoeff;
+  GEOGRAPHICLIB_TRANSVERSEMERCATOR_COEFF(TransverseMercatorAlpCoeff, 4) {
+    // alp[1]/n^1, polynomial in n of order 3
+    164, 225, -480, 360, 720,
+    // alp[2]/n^2, polynomial in n of order 2
+    557, -864, 390, 1440,
+    // alp[3]/n^3, polynomial in n of order 1
+    -1236, 427, 1680,
+    // alp[4]/n^4, polynomial in n of order 0
+    49561, 161280,
+  };  // count = 14
+  GEOGRAPHICLIB_TRANSVERSEMERCATOR_COEFF(TransverseMercatorAlpCoeff, 5) {
+    // alp[1]/n^1, polynomial in n of order 4
+    -635, 328, 450, -960, 720, 1440,
+    // alp[2]/n^2, polynomial in n of order 3
+    4496, 3899, -6048, 2730, 10080,
+    // alp[3]/n^3, polynomial in n of order 2
+    15061, -19776, 6832, 26880,
+    // alp[4]/n^4, polynomial in n of order 1
+    -171840, 49561, 161280,
+    // alp[5]/n^5, polynomial in n of order 0
+    34729, 80640,
+  };  // count = 20
+  GEOGRAPHICLIB_TRANSVERSEMERCATOR_COEFF(TransverseMercatorAlpCoeff, 6) {
+    // alp[1]/n^1, polynomial in n of order 5
+    31564, -66675, 34440, 47250, -100800, 75600, 151200,
+    // alp[2]/n^2, polynomial in n of order 4
+    -1983433, 863232, 748608, -1161216, 524160, 1935360,
+    // alp[3]/n^3, polynomial in n of order 3
+    670412, 406647, -533952, 184464, 725760,
+    // alp[4]/n^4, polynomial in n of order 2
+    6601661, -7732800, 2230245, 7257600,
+    // alp[5]/n^5, polynomial in n of order 1
+    -13675556, 3438171, 7983360,
+    // alp[6]/n^6, polynomial in n of order 0
+    212378941, 319334400,
+  };  // count = 27
+  GEOGRAPHICLIB_TRANSVERSEMERCATOR_COEFF(TransverseMercatorAlpCoeff, 7) {
+    // alp[1]/n^1, polynomial in n of order 6
+    1804025, 2020096, -4267200, 2204160, 3024000, -6451200, 4838400, 9676800,
+    // alp[2]/n^2, polynomial in n of order 5
+    4626384, -9917165, 4316160, 3743040, -5806080, 2620800, 9676800,
+    // alp[3]/n^3, polynomial in n of order 4
+    -67102379, 26816480, 16265880, -21358080, 7378560, 29030400,
+    // alp[4]/n^4, polynomial in n of order 3
+    155912000, 72618271, -85060800, 24532695, 79833600,
+    // alp[5]/n^5, polynomial in n of order 2
+    102508609, -109404448, 27505368, 63866880,
+    // alp[6]/n^6, polynomial in n of order 1
+    -12282192400LL, 2760926233LL, 4151347200LL,
+    // alp[7]/n^7, polynomial in n of order 0
+    1522256789, 1383782400,
+  };  // count = 35
+  GEOGRAPHICLIB_TRANSVERSEMERCATOR_COEFF(TransverseMercatorAlpCoeff, 8) {
+    // alp[1]/n^1, polynomial in n of order 7
+    -75900428, 37884525, 42422016, -89611200, 46287360, 63504000, -135475200,
+    101606400, 203212800,
+    // alp[2]/n^2, polynomial in n of order 6
+    148003883, 83274912, -178508970, 77690880, 67374720, -104509440,
+    47174400, 174182400,
+    // alp[3]/n^3, polynomial in n of order 5
+    318729724, -738126169, 294981280, 178924680, -234938880, 81164160,
+    319334400,
+    // alp[4]/n^4, polynomial in n of order 4
+    -40176129013LL, 14967552000LL, 6971354016LL, -8165836800LL, 2355138720LL,
+    7664025600LL,
+    // alp[5]/n^5, polynomial in n of order 3
+    10421654396LL, 3997835751LL, -4266773472LL, 1072709352, 2490808320LL,
+    // alp[6]/n^6, polynomial in n of order 2
+    175214326799LL, -171950693600LL, 38652967262LL, 58118860800LL,
+    // alp[7]/n^7, polynomial in n of order 1
+    -67039739596LL, 13700311101LL, 12454041600LL,
+    // alp[8]/n^8, polynomial in n of order 0
+    1424729850961LL, 743921418240LL,
+  };  // count = 44
+  template<typename T, int N> struct TransverseMercatorBetCoeff;
+  GEOGRAPHICLIB_TRANSVERSEMERCATOR_COEFF(TransverseMercatorBetCoeff, 4) {
+    // bet[1]/n^1, polynomial in n of order 3
+    -4, 555, -960, 720, 1440,
+    // bet[2]/n^2, polynomial in n of order 2
+    -437, 96, 30, 1440,
+    // bet[3]/n^3, polynomial in n of order 1
+    -148, 119, 3360,
+    // bet[4]/n^4, polynomial in n of order 0
+    4397, 161280,
+  };  // count = 14
+  GEOGRAPHICLIB_TRANSVERSEMERCATOR_COEFF(TransverseMercatorBetCoeff, 5) {
+    // bet[1]/n^1, polynomial in n of order 4
+    -3645, -64, 8880, -15360, 11520, 23040,
+    // bet[2]/n^2, polynomial in n of order 3
+    4416, -3059, 672, 210, 10080,
+    // bet[3]/n^3, polynomial in n of order 2
+    -627, -592, 476, 13440,
+    // bet[4]/n^4, polynomial in n of order 1
+    -3520, 4397, 161280,
+    // bet[5]/n^5, polynomial in n of order 0
+    4583, 161280,
+  };  // count = 20
+  GEOGRAPHICLIB_TRANSVERSEMERCATOR_COEFF(TransverseMercatorBetCoeff, 6) {
+    // bet[1]/n^1, polynomial in n of order 5
+    384796, -382725, -6720, 932400, -1612800, 1209600, 2419200,
+    // bet[2]/n^2, polynomial in n of order 4
+    -1118711, 1695744, -1174656, 258048, 80640, 3870720,
+    // bet[3]/n^3, polynomial in n of order 3
+    22276, -16929, -15984, 12852, 362880,
+    // bet[4]/n^4, polynomial in n of order 2
+    -830251, -158400, 197865, 7257600,
+    // bet[5]/n^5, polynomial in n of order 1
+    -435388, 453717, 15966720,
+    // bet[6]/n^6, polynomial in n of order 0
+    20648693, 638668800,
+  };  // count = 27
+  GEOGRAPHICLIB_TRANSVERSEMERCATOR_COEFF(TransverseMercatorBetCoeff, 7) {
+    // bet[1]/n^1, polynomial in n of order 6
+    -5406467, 6156736, -6123600, -107520, 14918400, -25804800, 19353600,
+    38707200,
+    // bet[2]/n^2, polynomial in n of order 5
+    829456, -5593555, 8478720, -5873280, 1290240, 403200, 19353600,
+    // bet[3]/n^3, polynomial in n of order 4
+    9261899, 3564160, -2708640, -2557440, 2056320, 58060800,
+    // bet[4]/n^4, polynomial in n of order 3
+    14928352, -9132761, -1742400, 2176515, 79833600,
+    // bet[5]/n^5, polynomial in n of order 2
+    -8005831, -1741552, 1814868, 63866880,
+    // bet[6]/n^6, polynomial in n of order 1
+    -261810608, 268433009, 8302694400LL,
+    // bet[7]/n^7, polynomial in n of order 0
+    219941297, 5535129600LL,
+  };  // count = 35
+  GEOGRAPHICLIB_TRANSVERSEMERCATOR_COEFF(TransverseMercatorBetCoeff, 8) {
+    // bet[1]/n^1, polynomial in n of order 7
+    31777436, -37845269, 43097152, -42865200, -752640, 104428800, -180633600,
+    135475200, 270950400,
+    // bet[2]/n^2, polynomial in n of order 6
+    24749483, 14930208, -100683990, 152616960, -105719040, 23224320, 7257600,
+    348364800,
+    // bet[3]/n^3, polynomial in n of order 5
+    -232468668, 101880889, 39205760, -29795040, -28131840, 22619520,
+    638668800,
+    // bet[4]/n^4, polynomial in n of order 4
+    324154477, 1433121792, -876745056, -167270400, 208945440, 7664025600LL,
+    // bet[5]/n^5, polynomial in n of order 3
+    457888660, -312227409, -67920528, 70779852, 2490808320LL,
+    // bet[6]/n^6, polynomial in n of order 2
+    -19841813847LL, -3665348512LL, 3758062126LL, 116237721600LL,
+    // bet[7]/n^7, polynomial in n of order 1
+    -1989295244, 1979471673, 49816166400LL,
+    // bet[8]/n^8, polynomial in n of order 0
+    191773887257LL, 3719607091200LL,
+  };  // count = 44
+
+  template<typename T>
+  TransverseMercatorT<T>::TransverseMercatorT(real a, real f, real k0)
     : _a(a)
     , _f(f)
     , _k0(k0)
@@ -61,199 +241,20 @@ namespace geographic_lib {
     if (!(Math::isfinite(_k0) && _k0 > 0))
       throw GeographicErr("Scale is not positive");
 
-    // Generated by Maxima on 2015-05-14 22:55:13-04:00
-#if GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER/2 == 2
-    static const real b1coeff[] = {
-      // b1*(n+1), polynomial in n2 of order 2
-      1, 16, 64, 64,
-    };  // count = 4
-#elif GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER/2 == 3
-    static const real b1coeff[] = {
-      // b1*(n+1), polynomial in n2 of order 3
-      1, 4, 64, 256, 256,
-    };  // count = 5
-#elif GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER/2 == 4
-    static const real b1coeff[] = {
-      // b1*(n+1), polynomial in n2 of order 4
-      25, 64, 256, 4096, 16384, 16384,
-    };  // count = 6
-#else
-#error "Bad value for GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER"
-#endif
-
-#if GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER == 4
-    static const real alpcoeff[] = {
-      // alp[1]/n^1, polynomial in n of order 3
-      164, 225, -480, 360, 720,
-      // alp[2]/n^2, polynomial in n of order 2
-      557, -864, 390, 1440,
-      // alp[3]/n^3, polynomial in n of order 1
-      -1236, 427, 1680,
-      // alp[4]/n^4, polynomial in n of order 0
-      49561, 161280,
-    };  // count = 14
-#elif GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER == 5
-    static const real alpcoeff[] = {
-      // alp[1]/n^1, polynomial in n of order 4
-      -635, 328, 450, -960, 720, 1440,
-      // alp[2]/n^2, polynomial in n of order 3
-      4496, 3899, -6048, 2730, 10080,
-      // alp[3]/n^3, polynomial in n of order 2
-      15061, -19776, 6832, 26880,
-      // alp[4]/n^4, polynomial in n of order 1
-      -171840, 49561, 161280,
-      // alp[5]/n^5, polynomial in n of order 0
-      34729, 80640,
-    };  // count = 20
-#elif GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER == 6
-    static const real alpcoeff[] = {
-      // alp[1]/n^1, polynomial in n of order 5
-      31564, -66675, 34440, 47250, -100800, 75600, 151200,
-      // alp[2]/n^2, polynomial in n of order 4
-      -1983433, 863232, 748608, -1161216, 524160, 1935360,
-      // alp[3]/n^3, polynomial in n of order 3
-      670412, 406647, -533952, 184464, 725760,
-      // alp[4]/n^4, polynomial in n of order 2
-      6601661, -7732800, 2230245, 7257600,
-      // alp[5]/n^5, polynomial in n of order 1
-      -13675556, 3438171, 7983360,
-      // alp[6]/n^6, polynomial in n of order 0
-      212378941, 319334400,
-    };  // count = 27
-#elif GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER == 7
-    static const real alpcoeff[] = {
-      // alp[1]/n^1, polynomial in n of order 6
-      1804025, 2020096, -4267200, 2204160, 3024000, -6451200, 4838400, 9676800,
-      // alp[2]/n^2, polynomial in n of order 5
-      4626384, -9917165, 4316160, 3743040, -5806080, 2620800, 9676800,
-      // alp[3]/n^3, polynomial in n of order 4
-      -67102379, 26816480, 16265880, -21358080, 7378560, 29030400,
-      // alp[4]/n^4, polynomial in n of order 3
-      155912000, 72618271, -85060800, 24532695, 79833600,
-      // alp[5]/n^5, polynomial in n of order 2
-      102508609, -109404448, 27505368, 63866880,
-      // alp[6]/n^6, polynomial in n of order 1
-      -12282192400LL, 2760926233LL, 4151347200LL,
-      // alp[7]/n^7, polynomial in n of order 0
-      1522256789, 1383782400,
-    };  // count = 35
-#elif GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER == 8
-    static const real alpcoeff[] = {
-      // alp[1]/n^1, polynomial in n of order 7
-      -75900428, 37884525, 42422016, -89611200, 46287360, 63504000, -135475200,
-      101606400, 203212800,
-      // alp[2]/n^2, polynomial in n of order 6
-      148003883, 83274912, -178508970, 77690880, 67374720, -104509440,
-      47174400, 174182400,
-      // alp[3]/n^3, polynomial in n of order 5
-      318729724, -738126169, 294981280, 178924680, -234938880, 81164160,
-      319334400,
-      // alp[4]/n^4, polynomial in n of order 4
-      -40176129013LL, 14967552000LL, 6971354016LL, -8165836800LL, 2355138720LL,
-      7664025600LL,
-      // alp[5]/n^5, polynomial in n of order 3
-      10421654396LL, 3997835751LL, -4266773472LL, 1072709352, 2490808320LL,
-      // alp[6]/n^6, polynomial in n of order 2
-      175214326799LL, -171950693600LL, 38652967262LL, 58118860800LL,
-      // alp[7]/n^7, polynomial in n of order 1
-      -67039739596LL, 13700311101LL, 12454041600LL,
-      // alp[8]/n^8, polynomial in n of order 0
-      1424729850961LL, 743921418240LL,
-    };  // count = 44
-#else
-#error "Bad value for GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER"
-#endif
-
-#if GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER == 4
-    static const real betcoeff[] = {
-      // bet[1]/n^1, polynomial in n of order 3
-      -4, 555, -960, 720, 1440,
-      // bet[2]/n^2, polynomial in n of order 2
-      -437, 96, 30, 1440,
-      // bet[3]/n^3, polynomial in n of order 1
-      -148, 119, 3360,
-      // bet[4]/n^4, polynomial in n of order 0
-      4397, 161280,
-    };  // count = 14
-#elif GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER == 5
-    static const real betcoeff[] = {
-      // bet[1]/n^1, polynomial in n of order 4
-      -3645, -64, 8880, -15360, 11520, 23040,
-      // bet[2]/n^2, polynomial in n of order 3
-      4416, -3059, 672, 210, 10080,
-      // bet[3]/n^3, polynomial in n of order 2
-      -627, -592, 476, 13440,
-      // bet[4]/n^4, polynomial in n of order 1
-      -3520, 4397, 161280,
-      // bet[5]/n^5, polynomial in n of order 0
-      4583, 161280,
-    };  // count = 20
-#elif GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER == 6
-    static const real betcoeff[] = {
-      // bet[1]/n^1, polynomial in n of order 5
-      384796, -382725, -6720, 932400, -1612800, 1209600, 2419200,
-      // bet[2]/n^2, polynomial in n of order 4
-      -1118711, 1695744, -1174656, 258048, 80640, 3870720,
-      // bet[3]/n^3, polynomial in n of order 3
-      22276, -16929, -15984, 12852, 362880,
-      // bet[4]/n^4, polynomial in n of order 2
-      -830251, -158400, 197865, 7257600,
-      // bet[5]/n^5, polynomial in n of order 1
-      -435388, 453717, 15966720,
-      // bet[6]/n^6, polynomial in n of order 0
-      20648693, 638668800,
-    };  // count = 27
-#elif GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER == 7
-    static const real betcoeff[] = {
-      // bet[1]/n^1, polynomial in n of order 6
-      -5406467, 6156736, -6123600, -107520, 14918400, -25804800, 19353600,
-      38707200,
-      // bet[2]/n^2, polynomial in n of order 5
-      829456, -5593555, 8478720, -5873280, 1290240, 403200, 19353600,
-      // bet[3]/n^3, polynomial in n of order 4
-      9261899, 3564160, -2708640, -2557440, 2056320, 58060800,
-      // bet[4]/n^4, polynomial in n of order 3
-      14928352, -9132761, -1742400, 2176515, 79833600,
-      // bet[5]/n^5, polynomial in n of order 2
-      -8005831, -1741552, 1814868, 63866880,
-      // bet[6]/n^6, polynomial in n of order 1
-      -261810608, 268433009, 8302694400LL,
-      // bet[7]/n^7, polynomial in n of order 0
-      219941297, 5535129600LL,
-    };  // count = 35
-#elif GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER == 8
-    static const real betcoeff[] = {
-      // bet[1]/n^1, polynomial in n of order 7
-      31777436, -37845269, 43097152, -42865200, -752640, 104428800, -180633600,
-      135475200, 270950400,
-      // bet[2]/n^2, polynomial in n of order 6
-      24749483, 14930208, -100683990, 152616960, -105719040, 23224320, 7257600,
-      348364800,
-      // bet[3]/n^3, polynomial in n of order 5
-      -232468668, 101880889, 39205760, -29795040, -28131840, 22619520,
-      638668800,
-      // bet[4]/n^4, polynomial in n of order 4
-      324154477, 1433121792, -876745056, -167270400, 208945440, 7664025600LL,
-      // bet[5]/n^5, polynomial in n of order 3
-      457888660, -312227409, -67920528, 70779852, 2490808320LL,
-      // bet[6]/n^6, polynomial in n of order 2
-      -19841813847LL, -3665348512LL, 3758062126LL, 116237721600LL,
-      // bet[7]/n^7, polynomial in n of order 1
-      -1989295244, 1979471673, 49816166400LL,
-      // bet[8]/n^8, polynomial in n of order 0
-      191773887257LL, 3719607091200LL,
-    };  // count = 44
-#else
-#error "Bad value for GEOGRAPHICLIB_TRANSVERSEMERCATOR_ORDER"
-#endif
-
-    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(b1coeff) / sizeof(real) ==
+    typedef TransverseMercatorB1Coeff<T, maxpow_/2> b1coeffs;
+    typedef TransverseMercatorAlpCoeff<T, maxpow_> alpcoeffs;
+    typedef TransverseMercatorBetCoeff<T, maxpow_> betcoeffs;
+    const real
+      *b1coeff = b1coeffs::coeff,
+      *alpcoeff = alpcoeffs::coeff,
+      *betcoeff = betcoeffs::coeff;
+    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(b1coeffs::coeff) / sizeof(real) ==
                                 maxpow_/2 + 2,
                                 "Coefficient array size mismatch for b1");
-    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(alpcoeff) / sizeof(real) ==
+    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(alpcoeffs::coeff) / sizeof(real) ==
                                 (maxpow_ * (maxpow_ + 3))/2,
                                 "Coefficient array size mismatch for alp");
-    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(betcoeff) / sizeof(real) ==
+    GEOGRAPHICLIB_STATIC_ASSERT(sizeof(betcoeffs::coeff) / sizeof(real) ==
                                 (maxpow_ * (maxpow_ + 3))/2,
                                 "Coefficient array size mismatch for bet");
     int m = maxpow_/2;
@@ -270,14 +271,15 @@ namespace geographic_lib {
       o += m + 2;
       d *= _n;
     }
-    // Post condition: o == sizeof(alpcoeff) / sizeof(real) &&
-    // o == sizeof(betcoeff) / sizeof(real)
+    // Post condition: o == sizeof(alpcoeffs::coeff) / sizeof(real) &&
+    // o == sizeof(betcoeffs::coeff) / sizeof(real)
   }
 
-  const TransverseMercator& TransverseMercator::UTM() {
-    static const TransverseMercator utm(Constants::WGS84_a(),
-                                        Constants::WGS84_f(),
-                                        Constants::UTM_k0());
+  template<typename T>
+  const TransverseMercatorT<T>& TransverseMercatorT<T>::UTM() {
+    static const TransverseMercatorT<T> utm(Constants::WGS84_a<T>(),
+                                            Constants::WGS84_f<T>(),
+                                            Constants::UTM_k0<T>());
     return utm;
   }
 
@@ -347,9 +349,10 @@ namespace geographic_lib {
   // There are adapted from TransverseMercatorExact (taup and taupinv).  tau =
   // tan(phi), taup = sinh(psi)
 
-  void TransverseMercator::Forward(real lon0, real lat, real lon,
-                                   real& x, real& y,
-                                   real& gamma, real& k) const {
+  template<typename T>
+  void TransverseMercatorT<T>::Forward(real lon0, real lat, real lon,
+                                       real& x, real& y,
+                                       real& gamma, real& k) const {
     lat = Math::LatFix(lat);
     lon = Math::AngDiff(lon0, lon);
     // Explicitly enforce the parity
@@ -408,7 +411,7 @@ namespace geographic_lib {
       k = sqrt(_e2m + _e2 * Math::sq(cphi)) * Math::hypot(real(1), tau)
         / Math::hypot(taup, clam);
     } else {
-      xip = Math::pi()/2;
+      xip = Math::pi<real>()/2;
       etap = 0;
       gamma = lon;
       k = _c;
@@ -504,7 +507,7 @@ namespace geographic_lib {
     gamma -= Math::atan2d(z1.imag(), z1.real());
     k *= _b1 * abs(z1);
     real xi = y1.real(), eta = y1.imag();
-    y = _a1 * _k0 * (backside ? Math::pi() - xi : xi) * latsign;
+    y = _a1 * _k0 * (backside ? Math::pi<real>() - xi : xi) * latsign;
     x = _a1 * _k0 * eta * lonsign;
     if (backside)
       gamma = 180 - gamma;
@@ -513,9 +516,10 @@ namespace geographic_lib {
     k *= _k0;
   }
 
-  void TransverseMercator::Reverse(real lon0, real x, real y,
-                                   real& lat, real& lon,
-                                   real& gamma, real& k) const {
+  template<typename T>
+  void TransverseMercatorT<T>::Reverse(real lon0, real x, real y,
+                                       real& lat, real& lon,
+                                       real& gamma, real& k) const {
     // This undoes the steps in Forward.  The wrinkles are: (1) Use of the
     // reverted series to express zeta' in terms of zeta. (2) Newton's method
     // to solve for phi in terms of tan(phi).
@@ -528,9 +532,9 @@ namespace geographic_lib {
       etasign = (eta < 0) ? -1 : 1;
     xi *= xisign;
     eta *= etasign;
-    bool backside = xi > Math::pi()/2;
+    bool backside = xi > Math::pi<real>()/2;
     if (backside)
-      xi = Math::pi() - xi;
+      xi = Math::pi<real>() - xi;
     real
       c0 = cos(2 * xi), ch0 = cosh(2 * eta),
       s0 = sin(2 * xi), sh0 = sinh(2 * eta);
@@ -593,4 +597,12 @@ namespace geographic_lib {
     k *= _k0;
   }
 
+  /// \cond SKIP
+  // Instantiate
+  template class GEOGRAPHICLIB_EXPORT TransverseMercatorT<Math::real>;
+#if GEOGRAPHICLIB_PRECISION != 1
+  template class GEOGRAPHICLIB_EXPORT TransverseMercatorT<float>;
+#endif
+  /// \endcond
+
 } // namespace geographic_lib